@@ -7,8 +7,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "LinkedList.h"
+#include "ListTiming.h"
 #include "BOARD.h"
 /*
  * 
@@ -25,6 +27,264 @@
  * This list supports NULL pointers as well.
  */
 
+//hint the cache to start loading address; harmless (and free) where there is no cache
+#ifdef __GNUC__
+#define LINKEDLIST_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define LINKEDLIST_PREFETCH(address)
+#endif
+
+//how many multi-item blocks (from LinkedListCompact()) can be alive at once
+#ifndef LINKEDLIST_MAX_BLOCKS
+#define LINKEDLIST_MAX_BLOCKS 8
+#endif
+
+//what a malloc() chunk costs beyond the bytes asked for, for the heap accounting: a size header,
+//then padding up to the alignment
+#ifndef LINKEDLIST_MALLOC_HEADER
+#define LINKEDLIST_MALLOC_HEADER sizeof (size_t)
+#endif
+#ifndef LINKEDLIST_MALLOC_ALIGN
+#define LINKEDLIST_MALLOC_ALIGN (2 * sizeof (size_t))
+#endif
+
+//the heap LinkedListCanInsert() starts out allowing ListItems: the board's whole 1024 byte heap,
+//and no limit on the host
+#ifndef LINKEDLIST_HEAP_LIMIT
+#ifdef __XC32
+#define LINKEDLIST_HEAP_LIMIT 1024
+#else
+#define LINKEDLIST_HEAP_LIMIT 0
+#endif
+#endif
+
+//with LINKEDLIST_NODE_CACHE on the host, single ListItems come from per-thread caches so several
+//threads can build and free lists at once, and the state every call touches is kept per thread or
+//updated atomically
+#if defined(LINKEDLIST_NODE_CACHE) && !defined(__XC32)
+#include "ListNodeCache.h"
+#define LINKEDLIST_MALLOC_ITEM() ListNodeCacheAllocate()
+#define LINKEDLIST_FREE_ITEM(item) ListNodeCacheFree(item)
+//the cache reports its own malloc() and free() calls through LinkedListAccountItems(), since items
+//it keeps for reuse are still on the heap
+#define LINKEDLIST_ACCOUNT_ITEM(take)
+#define LINKEDLIST_PER_THREAD __thread
+#define LINKEDLIST_LOAD(variable) __atomic_load_n(&(variable), __ATOMIC_RELAXED)
+#define LINKEDLIST_STORE(variable, value) __atomic_store_n(&(variable), (value), __ATOMIC_RELAXED)
+#define LINKEDLIST_ADD(variable, value) __atomic_add_fetch(&(variable), (value), __ATOMIC_RELAXED)
+#define LINKEDLIST_SUBTRACT(variable, value) \
+    __atomic_sub_fetch(&(variable), (value), __ATOMIC_RELAXED)
+//sets variable to value if it still holds expected, otherwise loads it into expected
+#define LINKEDLIST_EXCHANGE(variable, expected, value) __atomic_compare_exchange_n(&(variable), \
+    &(expected), (value), TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+#define LINKEDLIST_MALLOC_ITEM() malloc(sizeof (ListItem))
+#define LINKEDLIST_FREE_ITEM(item) free(item)
+#define LINKEDLIST_ACCOUNT_ITEM(take) LinkedListAccount(sizeof (ListItem), (take))
+#define LINKEDLIST_PER_THREAD
+#define LINKEDLIST_LOAD(variable) (variable)
+#define LINKEDLIST_STORE(variable, value) ((variable) = (value))
+#define LINKEDLIST_ADD(variable, value) ((variable) += (value))
+#define LINKEDLIST_SUBTRACT(variable, value) ((variable) -= (value))
+#define LINKEDLIST_EXCHANGE(variable, expected, value) ((variable) = (value), TRUE)
+#endif
+
+/*
+ * A single malloc()ed array holding several ListItems. The array is free()d once every item in it
+ * has been released.
+ */
+typedef struct ListBlock {
+    ListItem *items;
+    int count;
+    int live;
+} ListBlock;
+
+//number of ListItems malloc()ed by this library since the last reset
+static LINKEDLIST_PER_THREAD unsigned int allocationCount = 0;
+
+//bytes of heap (chunk overhead included) held by ListItems right now, and the most there has been
+//since the last reset
+static unsigned long heapInUse = 0;
+static unsigned long heapHighWater = 0;
+
+//most heap ListItems may use according to LinkedListCanInsert(), 0 for no limit
+static unsigned long heapLimit = LINKEDLIST_HEAP_LIMIT;
+
+//multi-item blocks currently in use, items == NULL marks a free slot
+static ListBlock blocks[LINKEDLIST_MAX_BLOCKS];
+
+/*
+ * Where LinkedListGetAt() last landed, in the list starting at head. head == NULL means nothing is
+ * remembered.
+ */
+typedef struct ListFinger {
+    ListItem *head;
+    ListItem *item;
+    int index;
+    ListItem *tail; //NULL until a walk has run into it
+    int size;
+    unsigned long generation; //the value of fingerGeneration when the finger was set
+} ListFinger;
+
+static LINKEDLIST_PER_THREAD ListFinger finger;
+
+//bumped by every change to any list, so a finger set before it (on any thread) isn't trusted: the
+//items it points at may have been freed, and with the node cache even handed out again
+static unsigned long fingerGeneration = 0;
+
+/*
+ * Estimates how much heap a malloc() of size bytes really takes: the allocator's header plus
+ * padding up to its alignment.
+ */
+static unsigned long LinkedListChunkBytes(unsigned long size)
+{
+    size += LINKEDLIST_MALLOC_HEADER;
+    return (size + LINKEDLIST_MALLOC_ALIGN - 1) / LINKEDLIST_MALLOC_ALIGN * LINKEDLIST_MALLOC_ALIGN;
+}
+
+/*
+ * Records that a chunk of size bytes was malloc()ed (or free()d, with take FALSE).
+ */
+static void LinkedListAccount(unsigned long size, int take)
+{
+    unsigned long inUse, highWater;
+    if (take) {
+        inUse = LINKEDLIST_ADD(heapInUse, LinkedListChunkBytes(size));
+        highWater = LINKEDLIST_LOAD(heapHighWater);
+        while (inUse > highWater && !LINKEDLIST_EXCHANGE(heapHighWater, highWater, inUse)) {
+        }
+    } else {
+        LINKEDLIST_SUBTRACT(heapInUse, LinkedListChunkBytes(size));
+    }
+}
+
+#if defined(LINKEDLIST_NODE_CACHE) && !defined(__XC32)
+/*
+ * Called by ListNodeCache.c whenever it malloc()s (take TRUE) or free()s (take FALSE) items.
+ */
+void LinkedListAccountItems(int count, int take)
+{
+    while (count-- > 0) {
+        LinkedListAccount(sizeof (ListItem), take);
+    }
+}
+#endif
+
+/*
+ * All ListItem allocations go through here so that LinkedListAllocationCount() and the heap
+ * accounting can see them.
+ */
+static ListItem *LinkedListAllocate(void)
+{
+    ListItem *item = LINKEDLIST_MALLOC_ITEM();
+    if (item != NULL) {
+        allocationCount++;
+        LINKEDLIST_ACCOUNT_ITEM(TRUE);
+    }
+    return item;
+}
+
+/*
+ * Allocates count contiguous ListItems in one block. Returns NULL if malloc() fails or every block
+ * slot is taken.
+ */
+static ListItem *LinkedListAllocateBlock(int count)
+{
+    int i;
+    for (i = 0; i < LINKEDLIST_MAX_BLOCKS; i++) {
+        if (blocks[i].items == NULL) {
+            blocks[i].items = malloc(count * sizeof (ListItem));
+            if (blocks[i].items == NULL) {
+                return NULL;
+            }
+            allocationCount += count;
+            LinkedListAccount(count * sizeof (ListItem), TRUE);
+            blocks[i].count = count;
+            blocks[i].live = count;
+            return blocks[i].items;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Returns the index of the block item lives in, or -1 if it was malloc()ed on its own.
+ */
+static int LinkedListBlockOf(const ListItem *item)
+{
+    int i;
+    for (i = 0; i < LINKEDLIST_MAX_BLOCKS; i++) {
+        if (blocks[i].items != NULL && item >= blocks[i].items
+                && item < blocks[i].items + blocks[i].count) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Gives back the memory of an item that is no longer linked into any list, whether it was
+ * malloc()ed on its own or lives in a block.
+ */
+static void LinkedListRelease(ListItem *item)
+{
+    int i = LinkedListBlockOf(item);
+    if (i < 0) {
+        LINKEDLIST_ACCOUNT_ITEM(FALSE);
+        LINKEDLIST_FREE_ITEM(item);
+    } else if (--blocks[i].live == 0) {
+        LinkedListAccount(blocks[i].count * sizeof (ListItem), FALSE);
+        free(blocks[i].items);
+        blocks[i].items = NULL;
+    }
+}
+
+/*
+ * Called by everything that adds, removes or relinks items, since any of those can move indices
+ * or free the item a finger is on.
+ */
+static void LinkedListForgetFinger(void)
+{
+    LINKEDLIST_ADD(fingerGeneration, 1);
+}
+
+/*
+ * Copies from's data, and its inline copy if it has one, into to.
+ */
+static void LinkedListCopyData(ListItem *to, const ListItem *from)
+{
+    to->data = from->data;
+#ifdef LINKEDLIST_INLINE_DATA
+    to->isInline = from->isInline;
+    if (from->isInline) {
+        memcpy(to->inlineData, from->inlineData, LINKEDLIST_INLINE_BYTES);
+    }
+#endif
+}
+
+/**
+ * LinkedListCompare() orders two data pointers the way LinkedListSort() does: NULL first, then by
+ * length and then alphabetically.
+ *
+ * @param first One data pointer. Can be NULL.
+ * @param second Another data pointer. Can be NULL.
+ * @return Less than, equal to or greater than 0 if first sorts before, with or after second.
+ */
+int LinkedListCompare(const char *first, const char *second)
+{
+    size_t len1, len2;
+    //NULLs count as 0-length strings that come before everything else, even ""
+    if (first == NULL || second == NULL) {
+        return (first != NULL) - (second != NULL);
+    }
+    len1 = strlen(first);
+    len2 = strlen(second);
+    if (len1 != len2) {
+        return (len1 < len2) ? -1 : 1;
+    }
+    return strcmp(first, second);
+}
+
 /*
  * This function starts a new linked list. Given an allocated pointer to data it will return a
  * pointer for a malloc()ed ListItem struct. If malloc() fails for any reason, then this function
@@ -36,14 +296,14 @@
  */
 ListItem *LinkedListNew(char *data)
 {
-    int size = sizeof (ListItem);
-    ListItem *newList = malloc(size);
+    LIST_TIMED_SCOPE(LIST_OP_NEW);
+    ListItem *newList = LinkedListAllocate();
     if (newList == NULL) {
         return NULL;
     } else {
         newList->nextItem = NULL;
         newList->previousItem = NULL;
-        newList->data = data;
+        LinkedListSetData(newList, data);
         return newList;
     }
 }
@@ -59,28 +319,30 @@ ListItem *LinkedListNew(char *data)
  */
 char *LinkedListRemove(ListItem *item)
 {
+    LIST_TIMED_SCOPE(LIST_OP_REMOVE);
     //NULL check
     if (item == NULL) {
         return NULL;
     }
     char *store;
     store = item->data;
+    LinkedListForgetFinger();
     //if this is the first item in a sequence
     if (item->nextItem != NULL && item->previousItem == NULL) {
         item->nextItem->previousItem = item->previousItem;
-        free(item);
+        LinkedListRelease(item);
         //if this is an item in the middle of a sequence
     } else if (item->nextItem != NULL) {
         item->nextItem->previousItem = item->previousItem;
         item->previousItem->nextItem = item->nextItem;
-        free(item);
+        LinkedListRelease(item);
         //if this is a lone item
     } else if (item->nextItem == NULL && item->previousItem == NULL) {
-        free(item);
+        LinkedListRelease(item);
         //if this is an item at the end of a sequence
     } else if (item->nextItem == NULL && item->previousItem != NULL) {
         item->previousItem->nextItem = NULL;
-        free(item);
+        LinkedListRelease(item);
         //item = item->previousItem;
     }
     return store;
@@ -96,17 +358,17 @@ char *LinkedListRemove(ListItem *item)
  */
 int LinkedListSize(ListItem *list)
 {
+    LIST_TIMED_SCOPE(LIST_OP_SIZE);
+    ListCursor cursor;
     int counter = 0;
     if (list == NULL) {
-        return NULL;
+        return 0;
     }
-    list = LinkedListGetFirst(list);
-    //printf("%s\n", list->data); //Get first is the issue
-    while (list->nextItem != NULL) {
-        list = list->nextItem;
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while (LinkedListCursorNext(&cursor) != NULL) {
         counter++;
     }
-    ++counter;
     return counter;
 }
 
@@ -120,23 +382,95 @@ int LinkedListSize(ListItem *list)
  */
 ListItem *LinkedListGetFirst(ListItem *list)
 {
-    //ListItem *tempList;
+    LIST_TIMED_SCOPE(LIST_OP_GET_FIRST);
+    ListCursor cursor;
+    ListItem *item;
     if (list == NULL) {
         return NULL;
     }
-    //printf("initial value %s\n", list->data);
+    LinkedListCursorInit(&cursor, list, LIST_BACKWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        list = item;
+    }
+    return list;
+}
 
-    //TESTING
-    if (list->previousItem != NULL) {
-        //printf("previous initial value %s\n", list->previousItem->data); //this is a fundamental issue
+/**
+ * LinkedListGetAt() returns the item at position index in a list, counting from 0 at the head. The
+ * library remembers where the last call landed (a "finger") and walks from whichever of the head,
+ * the finger or the tail (once a walk has found it) is closest, so stepping through a list by index,
+ * forwards, backwards or in small strides, costs O(1) per call instead of a walk from the head every
+ * time. Passing the head as list saves looking it up. Adding, removing or relinking items through
+ * this library, on any thread, makes it forget the finger, so it never points at an item that has
+ * moved or been freed. There is only one finger, so alternating between lists starts over each
+ * time, and it must not be used from more than one thread at once. Built with
+ * LINKEDLIST_NODE_CACHE, every thread has a finger of its own instead, but as any change on any
+ * thread still clears them all, stepping by index gets no faster than walking while other threads
+ * are changing lists.
+ *
+ * @param list Any element in the list, preferably its head.
+ * @param index The position of the item to return.
+ * @return The item at index, or NULL if list is NULL or index is out of range.
+ */
+ListItem *LinkedListGetAt(ListItem *list, int index)
+{
+    LIST_TIMED_SCOPE(LIST_OP_GET_AT);
+    ListCursor cursor;
+    ListItem *item, *next;
+    int position, steps, direction;
+    unsigned long generation;
+    if (list == NULL || index < 0) {
+        return NULL;
+    }
+    generation = LINKEDLIST_LOAD(fingerGeneration);
+    if (finger.generation != generation) {
+        finger.head = NULL;
+        finger.generation = generation;
+    }
+    if (list != finger.head) {
+        list = LinkedListGetFirst(list);
+        if (list != finger.head) {
+            finger.head = list;
+            finger.item = list;
+            finger.index = 0;
+            finger.tail = NULL;
+        }
+    }
+    if (finger.tail != NULL && index >= finger.size) {
+        return NULL;
     }
 
-    while (list->previousItem != NULL) {
-        list = list->previousItem;
-        //printf("sort value %s\n", list->data);
+    //start from whichever known item is closest
+    item = finger.item;
+    position = finger.index;
+    if (index < abs(index - position)) {
+        item = finger.head;
+        position = 0;
     }
-    //printf("return value %s\n", list->data);
-    return list;
+    if (finger.tail != NULL && finger.size - 1 - index < abs(index - position)) {
+        item = finger.tail;
+        position = finger.size - 1;
+    }
+
+    direction = (index >= position) ? LIST_FORWARD : LIST_BACKWARD;
+    steps = abs(index - position);
+    //only long walks are worth setting up prefetching for
+    LinkedListCursorInit(&cursor, item, direction,
+            (steps > LINKEDLIST_PREFETCH_DISTANCE) ? LINKEDLIST_PREFETCH_DISTANCE : 0);
+    LinkedListCursorNext(&cursor);
+    while (steps > 0 && (next = LinkedListCursorNext(&cursor)) != NULL) {
+        item = next;
+        position += direction;
+        steps--;
+    }
+    if (item->nextItem == NULL) {
+        finger.tail = item;
+        finger.size = position + 1;
+    }
+    finger.item = item;
+    finger.index = position;
+    //a walk that stopped short ran off the end of the list
+    return (steps == 0) ? item : NULL;
 }
 
 /**
@@ -152,42 +486,97 @@ ListItem *LinkedListGetFirst(ListItem *list)
  */
 ListItem *LinkedListCreateAfter(ListItem *item, char *data)
 {
-    ListItem *nextList = malloc(sizeof (ListItem));
+    LIST_TIMED_SCOPE(LIST_OP_CREATE_AFTER);
+    ListItem *nextList = LinkedListAllocate();
+    LinkedListForgetFinger();
     if (nextList == NULL) {
         return NULL;
+        //if this is the first in a sequence
+    } else if (item == NULL) {
+        LinkedListSetData(nextList, data);
+        nextList->previousItem = NULL;
+        nextList->nextItem = NULL;
+        return nextList;
         //if this is at the end of a sequence
     } else if (item->nextItem == NULL) {
-        nextList->data = data;
+        LinkedListSetData(nextList, data);
         nextList->previousItem = item;
         nextList->nextItem = NULL;
         item->nextItem = nextList;
-        //item=item->nextItem;
-
-        //printf("1\n");
-
-        return item;
+        return nextList;
 
     }//if this is in the middle of a sequence
-    else if (item->nextItem != NULL) {
-        nextList->data = data;
-        nextList->previousItem = item;
-        nextList->nextItem = item->nextItem;
+    LinkedListSetData(nextList, data);
+    nextList->previousItem = item;
+    nextList->nextItem = item->nextItem;
 
-        item->nextItem->previousItem = nextList;
-        item->nextItem = nextList;
+    item->nextItem->previousItem = nextList;
+    item->nextItem = nextList;
 
-        //printf("3\n");
+    //printf("3\n");
 
-        return nextList;
-    }
-    //if this is the first in a sequence
-    nextList->data = data;
-    nextList->previousItem = NULL;
-    nextList->nextItem = NULL;
+    return nextList;
+}
 
-    //printf("4\n");
+/**
+ * LinkedListCreateAfterN() inserts k new ListItems holding data[0] to data[k - 1], in that order,
+ * directly after item. The k items are allocated together in one block (when a block slot is free,
+ * see LinkedListCompact()) and linked to each other before the run is spliced in, so the rest of
+ * the list only has its pointers rewritten once at each end of the run. If passed a NULL item the
+ * run becomes a new list of its own. If any allocation fails nothing is inserted and NULL is
+ * returned.
+ *
+ * @param item The ListItem that will be before the new items. Can be NULL.
+ * @param data The k data pointers to store. Any of them can be NULL.
+ * @param k How many items to create.
+ * @param last[out] If not NULL, where to store the last new item.
+ * @return The first new item, or NULL if data was NULL, k wasn't positive or malloc() failed.
+ */
+ListItem *LinkedListCreateAfterN(ListItem *item, char **data, int k, ListItem **last)
+{
+    LIST_TIMED_SCOPE(LIST_OP_CREATE_AFTER_N);
+    ListItem *block, *head = NULL, *tail = NULL, *newItem;
+    int i;
+    if (data == NULL || k <= 0) {
+        return NULL;
+    }
+    LinkedListForgetFinger();
+    //fall back to one malloc() per item when k is 1 or every block slot is taken
+    block = (k > 1) ? LinkedListAllocateBlock(k) : NULL;
+    for (i = 0; i < k; i++) {
+        newItem = (block != NULL) ? &block[i] : LinkedListAllocate();
+        if (newItem == NULL) {
+            while (head != NULL) {
+                newItem = head->nextItem;
+                LinkedListRelease(head);
+                head = newItem;
+            }
+            return NULL;
+        }
+        LinkedListSetData(newItem, data[i]);
+        newItem->previousItem = tail;
+        newItem->nextItem = NULL;
+        if (tail != NULL) {
+            tail->nextItem = newItem;
+        } else {
+            head = newItem;
+        }
+        tail = newItem;
+    }
 
-    return nextList;
+    //splice the whole run in at once
+    if (item != NULL) {
+        head->previousItem = item;
+        tail->nextItem = item->nextItem;
+        if (item->nextItem != NULL) {
+            item->nextItem->previousItem = tail;
+        }
+        item->nextItem = head;
+    }
+    if (last != NULL) {
+        *last = tail;
+    }
+    return head;
 }
 
 /**
@@ -204,158 +593,359 @@ ListItem *LinkedListCreateAfter(ListItem *item, char *data)
  */
 int LinkedListSwapData(ListItem *firstItem, ListItem *secondItem)
 {
-    ListItem *tempList2 = malloc(sizeof (ListItem));
+    LIST_TIMED_SCOPE(LIST_OP_SWAP_DATA);
+    ListItem temp;
     if (firstItem == NULL || secondItem == NULL) {
         return STANDARD_ERROR;
-    } else {
-        tempList2->data = firstItem->data;
-        firstItem->data = secondItem->data;
-        secondItem->data = tempList2->data;
-        return SUCCESS;
     }
+    LinkedListCopyData(&temp, firstItem);
+    LinkedListCopyData(firstItem, secondItem);
+    LinkedListCopyData(secondItem, &temp);
+    return SUCCESS;
+}
+
+/**
+ * LinkedListSetData() changes the data stored in item, keeping its inline copy (see
+ * LINKEDLIST_DATA()) up to date.
+ *
+ * @param item The item to change.
+ * @param data The new data pointer. Can be NULL.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetData(ListItem *item, char *data)
+{
+#ifdef LINKEDLIST_INLINE_DATA
+    size_t length;
+#endif
+    if (item == NULL) {
+        return STANDARD_ERROR;
+    }
+    item->data = data;
+#ifdef LINKEDLIST_INLINE_DATA
+    item->isInline = 0;
+    if (data != NULL) {
+        length = strlen(data);
+        if (length < LINKEDLIST_INLINE_BYTES) {
+            memcpy(item->inlineData, data, length + 1);
+            item->isInline = 1;
+        }
+    }
+#endif
+    return SUCCESS;
 }
 
 /**
- * LinkedListSort() performs a selection sort on list to sort the elements into descending order. It
+ * LinkedListSort() performs an insertion sort on list to sort the elements into ascending order. It
  * makes no guarantees of the addresses of the list items after sorting, so any ListItem referenced
  * before a call to LinkedListSort() and after may contain different data as only the data pointers
- * for the ListItems in the list are swapped. This function sorts the strings in ascending order
- * first by size (with NULL data pointers counting as 0-length strings) and then alphabetically
- * ascending order. So the list [dog, cat, duck, goat, NULL] will be sorted to [NULL, cat, dog,
- * duck, goat]. LinkedListSort() returns SUCCESS if sorting was possible. If passed a NULL pointer
- * for either argument, it will do nothing and return STANDARD_ERROR.
+ * for the ListItems in the list are swapped. No ListItems are created or freed, so sorting never
+ * touches the heap. This function sorts the strings in ascending order first by size (with NULL
+ * data pointers counting as 0-length strings) and then alphabetically ascending order. So the list
+ * [dog, cat, duck, goat, NULL] will be sorted to [NULL, cat, dog, duck, goat]. LinkedListSort()
+ * returns SUCCESS if sorting was possible. If passed a NULL pointer for either argument, it will
+ * do nothing and return STANDARD_ERROR.
  *
  * @param list Any element in the list to sort.
  * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
  */
 int LinkedListSort(ListItem *list)
 {
-    int strLen1, strLen2;
-    char *strCmp1, *strCmp2;
-    ListItem *firstHolder;
-    int i, listSize, clear, nullCounter;
-    char *temp;
-    //LinkedListPrint(list);
-    listSize = LinkedListSize(list);
-    //printf("list size %i\n", listSize);
-    nullCounter = 0;
-
-    //NULL CATCHER
-    list = LinkedListGetFirst(list);
-    firstHolder = LinkedListGetFirst(list);
-
-    while (list != NULL) {
-        //if this is data is null and there is nothing after it
-        if (list->data == NULL && list->nextItem == NULL) {
-            LinkedListRemove(list);
-            nullCounter++;
-            --listSize;
-            list = list->previousItem->previousItem;
-            break;
-            //list = list->previousItem->previousItem;
-        }//if the data is null and there is something after it
-        else if (list->data == NULL && list->nextItem->data != NULL) {
-            LinkedListRemove(list);
-            nullCounter++;
-            --listSize;
-        }//if thedata is null and the next data is null
-        else if (list->data == NULL && list->nextItem->data == NULL) {
-            while (list->data == NULL) {
-                LinkedListRemove(list);
-                nullCounter++;
-                --listSize;
-                list = list->nextItem;
+    LIST_TIMED_SCOPE(LIST_OP_SORT);
+    ListCursor cursor;
+    ListItem *sorted, *scan;
+    ListItem key;
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    //insertion sort on the data pointers only, NULLs included, so the ListItems themselves are
+    //never removed or re-malloc()ed and the list stays where the caller left it
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((sorted = LinkedListCursorNext(&cursor)) != NULL) {
+        LinkedListCopyData(&key, sorted);
+        //the backward shift only revisits items the cursor just brought in, so it walks them
+        //directly
+        scan = sorted;
+        while (scan->previousItem != NULL && LinkedListCompare(LINKEDLIST_DATA(scan->previousItem),
+                LINKEDLIST_DATA(&key)) > 0) {
+            LinkedListCopyData(scan, scan->previousItem);
+            scan = scan->previousItem;
+        }
+        LinkedListCopyData(scan, &key);
+    }
+    return SUCCESS;
+}
 
-            }
+/*
+ * Stably merges two sorted, NULL-terminated runs linked through nextItem only.
+ */
+static ListItem *LinkedListMergeRuns(ListItem *first, ListItem *second)
+{
+    ListItem head;
+    ListItem *tail = &head;
+    while (first != NULL && second != NULL) {
+        //ties go to the first run, which keeps the merge stable
+        if (LinkedListCompare(LINKEDLIST_DATA(first), LINKEDLIST_DATA(second)) <= 0) {
+            tail->nextItem = first;
+            first = first->nextItem;
+        } else {
+            tail->nextItem = second;
+            second = second->nextItem;
         }
-        list = list->nextItem;
+        tail = tail->nextItem;
     }
-    //listSize = LinkedListSize(list);
+    tail->nextItem = (first != NULL) ? first : second;
+    return head.nextItem;
+}
 
-    //NULL REMOVAL TEST
-    //LinkedListPrint(list);
+/*
+ * Detaches the natural run starting at *rest and returns it as a NULL-terminated chain linked
+ * through nextItem, advancing *rest past it. Strictly descending runs are reversed as they are
+ * taken (strictly, so equal items never swap places) and short runs are topped up to
+ * LINKEDLIST_MIN_RUN items by stable insertion.
+ */
+static ListItem *LinkedListTakeRun(ListItem **rest, int *length)
+{
+    ListItem *head = *rest;
+    ListItem *item = head->nextItem;
+    ListItem *next, *scan;
+    int count = 1;
 
-    //LENGTH SORT
-    list = firstHolder;
-    while (1) {
+    if (item != NULL && LinkedListCompare(LINKEDLIST_DATA(head), LINKEDLIST_DATA(item)) > 0) {
+        head->nextItem = NULL;
+        while (item != NULL
+                && LinkedListCompare(LINKEDLIST_DATA(head), LINKEDLIST_DATA(item)) > 0) {
+            next = item->nextItem;
+            item->nextItem = head;
+            head = item;
+            item = next;
+            count++;
+        }
+    } else {
+        scan = head;
+        while (item != NULL
+                && LinkedListCompare(LINKEDLIST_DATA(scan), LINKEDLIST_DATA(item)) <= 0) {
+            scan = item;
+            item = item->nextItem;
+            count++;
+        }
+        scan->nextItem = NULL;
+    }
 
-        clear = 0;
-        i = 0;
-        list = LinkedListGetFirst(list);
-        listSize = listSize - 1;
-        for (i = 0; i < listSize; i++) {
-            strLen1 = strlen(list->data);
-            strLen2 = strlen(list->nextItem->data);
-            //printf("%d %d\n", strLen1, strLen2);
-            //compare string length
-            if (strLen1 > strLen2) {
-                if (list == NULL || list->nextItem == NULL) {
-                    return STANDARD_ERROR;
-                }
-                temp = list->data;
-                list->data = list->nextItem->data;
-                list->nextItem->data = temp;
-                clear = 1;
+    //insert each following item after the last run item that isn't bigger than it
+    while (count < LINKEDLIST_MIN_RUN && item != NULL) {
+        next = item->nextItem;
+        if (LinkedListCompare(LINKEDLIST_DATA(head), LINKEDLIST_DATA(item)) > 0) {
+            item->nextItem = head;
+            head = item;
+        } else {
+            scan = head;
+            while (scan->nextItem != NULL && LinkedListCompare(LINKEDLIST_DATA(scan->nextItem),
+                    LINKEDLIST_DATA(item)) <= 0) {
+                scan = scan->nextItem;
             }
-            list = list->nextItem;
-
-        }
-        if (clear == 0) {
-            break;
+            item->nextItem = scan->nextItem;
+            scan->nextItem = item;
         }
+        item = next;
+        count++;
+    }
+    *rest = item;
+    *length = count;
+    return head;
+}
 
+/*
+ * Stably moves the NULL items of the chain starting at head in front of the others, in one pass and
+ * by relinking nextItem only. Returns the new head and sets *rest to the first non-NULL item and
+ * *lastNull to the last NULL one (NULL if there are none).
+ */
+static ListItem *LinkedListPartitionChain(ListItem *head, ListItem **rest, ListItem **lastNull)
+{
+    ListItem nulls, others;
+    ListItem *nullTail = &nulls, *otherTail = &others;
+    for (; head != NULL; head = head->nextItem) {
+        if (head->data == NULL) {
+            nullTail->nextItem = head;
+            nullTail = head;
+        } else {
+            otherTail->nextItem = head;
+            otherTail = head;
+        }
     }
-    //LinkedListPrint(list);
-    listSize = LinkedListSize(list);
+    otherTail->nextItem = NULL;
+    nullTail->nextItem = others.nextItem;
+    *rest = others.nextItem;
+    *lastNull = (nullTail != &nulls) ? nullTail : NULL;
+    return nulls.nextItem;
+}
 
-    //ALPHA SORT
-    while (1) {
-        clear = 0;
-        list = LinkedListGetFirst(list);
-        for (i = 0; i < (listSize - 1); i++) {
-            strCmp1 = list->data;
-            strCmp2 = list->nextItem->data;
-            strLen1 = strlen(list->data);
-            strLen2 = strlen(list->nextItem->data);
-            //printf("%d %d\n", strLen1, strLen2);
-            //if string lengths equal then compare letters
-            if (strLen1 == strLen2) {
-                if (list == NULL || list->nextItem == NULL) {
-                    return STANDARD_ERROR;
-                }
-                if (strcmp(strCmp1, strCmp2) > 0) {
-                    temp = list->data;
-                    list->data = list->nextItem->data;
-                    list->nextItem->data = temp;
-                    clear = 1;
+/*
+ * The Timsort-style part of LinkedListSortNatural(): sorts the list starting at head and returns the
+ * new head, with the items linked through nextItem only.
+ */
+static ListItem *LinkedListSortChain(ListItem *head)
+{
+    //Timsort's invariants keep run lengths growing at least like the Fibonacci numbers from the top
+    //of the stack down, so 64 entries covers any list that fits in memory
+    ListItem *runs[64];
+    int lengths[64];
+    int depth = 0;
+    ListItem *rest, *lastNull;
+    //NULLs sort first and all compare equal, so partitioning them out first is already their final
+    //order, and the runs left to find aren't broken up by NULLs scattered through them
+    head = LinkedListPartitionChain(head, &rest, &lastNull);
+    if (rest == NULL) {
+        return head;
+    }
+    while (rest != NULL) {
+        runs[depth] = LinkedListTakeRun(&rest, &lengths[depth]);
+        depth++;
+        //merge until the run lengths shrink fast enough going up the stack
+        while (depth > 1) {
+            int top = depth - 1;
+            if ((depth > 2 && lengths[top - 2] <= lengths[top - 1] + lengths[top])
+                    || (depth > 3 && lengths[top - 3] <= lengths[top - 2] + lengths[top - 1])) {
+                //merge the smaller of the top run and the one under the middle into the middle
+                if (lengths[top - 2] < lengths[top]) {
+                    runs[top - 2] = LinkedListMergeRuns(runs[top - 2], runs[top - 1]);
+                    lengths[top - 2] += lengths[top - 1];
+                    runs[top - 1] = runs[top];
+                    lengths[top - 1] = lengths[top];
+                    depth--;
+                    continue;
                 }
+            } else if (lengths[top - 1] > lengths[top]) {
+                break;
             }
-            list = list->nextItem;
-        }
-        if (clear == 0) {
-            break;
+            runs[top - 1] = LinkedListMergeRuns(runs[top - 1], runs[top]);
+            lengths[top - 1] += lengths[top];
+            depth--;
         }
     }
+    while (depth > 1) {
+        runs[depth - 2] = LinkedListMergeRuns(runs[depth - 2], runs[depth - 1]);
+        lengths[depth - 2] += lengths[depth - 1];
+        depth--;
+    }
+    if (lastNull == NULL) {
+        return runs[0];
+    }
+    lastNull->nextItem = runs[0];
+    return head;
+}
 
-    //NULL reentry
-    ListItem *nullAdder;
-    //char *tempNext, *tempPrevious;
-    list = LinkedListGetFirst(list);
-    //place the nulls we removed at the beginning of the function 
-    //into the beginning of the ListItem
-    for (i = 0; i < nullCounter; i++) {
-        nullAdder = malloc(sizeof (ListItem));
-        nullAdder->previousItem = NULL;
-        nullAdder->nextItem = list;
-        nullAdder->data = NULL;
-        list->previousItem = nullAdder;
-        list = list->previousItem;
-
+/**
+ * LinkedListSortNatural() sorts a list into the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically) but adapts to how ordered the list already is. It finds the runs
+ * that are already ascending (or strictly descending, which it reverses), tops short runs up to
+ * LINKEDLIST_MIN_RUN items by insertion, and merges neighbouring runs Timsort-style. An already
+ * sorted list costs a single pass, and a sorted list with a few items appended costs little more.
+ * The sort is stable and allocates nothing.
+ *
+ * Unlike LinkedListSort(), this relinks the ListItems instead of swapping their data, so every
+ * ListItem keeps its data but may end up at a different position; list may no longer be the head
+ * afterwards, so use LinkedListGetFirst() to find it.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR if passed a NULL pointer.
+ */
+int LinkedListSortNatural(ListItem *list)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SORT_NATURAL);
+    ListItem *previous;
+    if (list == NULL) {
+        return STANDARD_ERROR;
     }
+    LinkedListForgetFinger();
+    list = LinkedListSortChain(LinkedListGetFirst(list));
 
+    //runs were only linked forwards, so rebuild the backward links in one last pass
+    previous = NULL;
+    for (; list != NULL; list = list->nextItem) {
+        list->previousItem = previous;
+        previous = list;
+    }
     return SUCCESS;
 }
 
+/**
+ * LinkedListPartitionNull() moves every item with NULL data to the front of a list, keeping the
+ * order of the NULL items and of the others. It works by relinking alone, in a single pass, so
+ * nothing is allocated or freed and every ListItem keeps its address and data. The relinking sorts
+ * do this as their first stage.
+ *
+ * @param list Any element in the list to partition.
+ * @return The new head of the list, or NULL if list was NULL.
+ */
+ListItem *LinkedListPartitionNull(ListItem *list)
+{
+    LIST_TIMED_SCOPE(LIST_OP_PARTITION_NULL);
+    ListItem *rest, *lastNull, *previous = NULL, *item;
+    if (list == NULL) {
+        return NULL;
+    }
+    LinkedListForgetFinger();
+    list = LinkedListPartitionChain(LinkedListGetFirst(list), &rest, &lastNull);
+    for (item = list; item != NULL; item = item->nextItem) {
+        item->previousItem = previous;
+        previous = item;
+    }
+    return list;
+}
+
+/**
+ * LinkedListSortAndCount() sorts a list exactly like LinkedListSortNatural() and reports every run
+ * of equal items in the sorted list to callback, in order, in the same pass that finishes the sort
+ * by rebuilding the backward links. That saves the separate LinkedListSize() and counting walks
+ * over the sorted list. Runs are reported as the data of their first item and their length, and a
+ * run of NULL items is reported with NULL data, just like SortedWordRunsForEach() in WordCount.c.
+ * If callback returns STANDARD_ERROR no more runs are reported, but the list is still completely
+ * sorted.
+ *
+ * @param list Any element in the list to sort.
+ * @param callback Called for each run of equal items, in sorted order.
+ * @param context Passed through to callback untouched.
+ * @param head[out] If not NULL, where to store the head of the sorted list.
+ * @return SUCCESS, or STANDARD_ERROR if list or callback is NULL or callback returned
+ *         STANDARD_ERROR.
+ */
+int LinkedListSortAndCount(ListItem *list, ListRunCallback callback, void *context,
+        ListItem **head)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SORT_AND_COUNT);
+    ListItem *previous = NULL, *runStart = NULL;
+    int count = 0, status = SUCCESS;
+    if (list == NULL || callback == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListForgetFinger();
+    list = LinkedListSortChain(LinkedListGetFirst(list));
+    if (head != NULL) {
+        *head = list;
+    }
+
+    //rebuild the backward links, closing a run whenever the data changes
+    for (; list != NULL; list = list->nextItem) {
+        list->previousItem = previous;
+        previous = list;
+        if (runStart != NULL && (LINKEDLIST_DATA(runStart) == LINKEDLIST_DATA(list)
+                || LinkedListCompare(LINKEDLIST_DATA(runStart), LINKEDLIST_DATA(list)) == 0)) {
+            count++;
+            continue;
+        }
+        if (runStart != NULL && status == SUCCESS) {
+            status = callback(runStart->data, count, context);
+        }
+        runStart = list;
+        count = 1;
+    }
+    if (runStart != NULL && status == SUCCESS) {
+        status = callback(runStart->data, count, context);
+    }
+    return (status == STANDARD_ERROR) ? STANDARD_ERROR : SUCCESS;
+}
+
 /**
  * LinkedListPrint() prints out the complete list to stdout. This function prints out the given
  * list, starting at the head if the provided pointer is not the head of the list, like "[STRING1,
@@ -367,21 +957,398 @@ int LinkedListSort(ListItem *list)
  */
 int LinkedListPrint(ListItem * list)
 {
-    int listLength, i;
+    LIST_TIMED_SCOPE(LIST_OP_PRINT);
+    ListCursor cursor;
     if (list == NULL) {
         return STANDARD_ERROR;
     }
-    listLength = LinkedListSize(list);
-    list = LinkedListGetFirst(list);
-    //printf("List size = %i [ ", listLength); //Get size is the issue (testing)
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
     printf("[");
-    for (i = 0; i < (listLength - 1); i++) {
-        printf("%s ", list->data);
-        list = list->nextItem;
+    while ((list = LinkedListCursorNext(&cursor)) != NULL) {
+        printf(list->nextItem != NULL ? "%s " : "%s", list->data);
+    }
+    printf("]\n");
+    return SUCCESS;
+}
+
+/**
+ * LinkedListAllocationCount() returns how many ListItems this library has malloc()ed since the last
+ * call to LinkedListResetAllocationCount() (or since startup).
+ *
+ * @return The number of ListItem allocations.
+ */
+unsigned int LinkedListAllocationCount(void)
+{
+    return allocationCount;
+}
+
+/**
+ * LinkedListResetAllocationCount() sets the allocation counter back to 0.
+ */
+void LinkedListResetAllocationCount(void)
+{
+    allocationCount = 0;
+}
+
+/**
+ * LinkedListMemoryUsage() reports how much memory a list takes. Items that live in a block share
+ * its malloc() chunk, so the block's header and any of its slots not in this list are counted as
+ * overhead; a block shared with another list is counted by both.
+ *
+ * @param list Any element in the list to measure.
+ * @param countStrings TRUE to also add up the strings the items point to (NUL included), for lists
+ *                     that own their strings.
+ * @param usage Where to store the results.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListMemoryUsage(ListItem *list, int countStrings, ListMemoryUsage *usage)
+{
+    LIST_TIMED_SCOPE(LIST_OP_MEMORY_USAGE);
+    ListCursor cursor;
+    int inBlock[LINKEDLIST_MAX_BLOCKS] = {0};
+    int i;
+    if (list == NULL || usage == NULL) {
+        return STANDARD_ERROR;
+    }
+    memset(usage, 0, sizeof (ListMemoryUsage));
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((list = LinkedListCursorNext(&cursor)) != NULL) {
+        usage->items++;
+        i = LinkedListBlockOf(list);
+        if (i < 0) {
+            usage->overheadBytes += LinkedListChunkBytes(sizeof (ListItem)) - sizeof (ListItem);
+        } else {
+            inBlock[i]++;
+        }
+        if (countStrings && list->data != NULL) {
+            usage->stringBytes += strlen(list->data) + 1;
+        }
+    }
+    usage->itemBytes = usage->items * sizeof (ListItem);
+    for (i = 0; i < LINKEDLIST_MAX_BLOCKS; i++) {
+        if (inBlock[i] > 0) {
+            usage->overheadBytes += LinkedListChunkBytes(blocks[i].count * sizeof (ListItem))
+                    - inBlock[i] * sizeof (ListItem);
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * LinkedListHeapInUse() returns how many bytes of heap the library's ListItems hold right now,
+ * estimated allocator overhead included. Built with LINKEDLIST_NODE_CACHE, items waiting in the
+ * node caches still count until they go back to free().
+ *
+ * @return The bytes in use.
+ */
+unsigned long LinkedListHeapInUse(void)
+{
+    return LINKEDLIST_LOAD(heapInUse);
+}
+
+/**
+ * LinkedListHeapHighWater() returns the most heap the library's ListItems have held at once since
+ * startup or the last LinkedListResetHeapHighWater(), counted like LinkedListHeapInUse().
+ *
+ * @return The high-water mark in bytes.
+ */
+unsigned long LinkedListHeapHighWater(void)
+{
+    return LINKEDLIST_LOAD(heapHighWater);
+}
+
+/**
+ * LinkedListResetHeapHighWater() brings the high-water mark down to what is in use right now.
+ */
+void LinkedListResetHeapHighWater(void)
+{
+    LINKEDLIST_STORE(heapHighWater, LINKEDLIST_LOAD(heapInUse));
+}
+
+/**
+ * LinkedListSetHeapLimit() sets how much heap LinkedListCanInsert() lets ListItems use. It starts
+ * as LINKEDLIST_HEAP_LIMIT: 1024 bytes (the board's whole heap) on the board, and no limit on the
+ * host, where it can be set to plan for the board.
+ *
+ * @param bytes The limit in bytes, or 0 for no limit.
+ */
+void LinkedListSetHeapLimit(unsigned long bytes)
+{
+    heapLimit = bytes;
+}
+
+/**
+ * LinkedListCanInsert() predicts whether n more LinkedListCreateAfter() calls will fit within the
+ * heap limit, given what ListItems already use. The prediction assumes one malloc() per item, so a
+ * block from LinkedListCreateAfterN() needs no more than predicted. It can't account for anything
+ * else on the heap, so leave room for that in the limit.
+ *
+ * @param n How many items are about to be inserted.
+ * @return TRUE if they are expected to fit (always, with no limit), FALSE if not or n is negative.
+ */
+int LinkedListCanInsert(int n)
+{
+    if (n < 0) {
+        return FALSE;
+    }
+    if (heapLimit == 0) {
+        return TRUE;
+    }
+    return LINKEDLIST_LOAD(heapInUse) + n * LinkedListChunkBytes(sizeof (ListItem)) <= heapLimit;
+}
+
+/**
+ * LinkedListCursorInit() sets up cursor to walk the list starting at start (inclusive) in the given
+ * direction. The cursor keeps a second pointer prefetchDistance items further along and prefetches
+ * each item (and its string) as that pointer reaches it, so by the time LinkedListCursorNext()
+ * gets to an item it is hopefully already in cache. A prefetchDistance of 0 disables prefetching.
+ *
+ * @param cursor The cursor to set up.
+ * @param start The first item LinkedListCursorNext() will return. Can be NULL for an empty walk.
+ * @param direction LIST_FORWARD to follow nextItem, LIST_BACKWARD to follow previousItem.
+ * @param prefetchDistance How many items ahead of the current one to prefetch.
+ */
+void LinkedListCursorInit(ListCursor *cursor, ListItem *start, int direction, int prefetchDistance)
+{
+    int i;
+    cursor->current = start;
+    cursor->ahead = start;
+    cursor->direction = direction;
+    for (i = 0; i < prefetchDistance && cursor->ahead != NULL; i++) {
+        cursor->ahead = (direction == LIST_FORWARD) ?
+                cursor->ahead->nextItem : cursor->ahead->previousItem;
+        LINKEDLIST_PREFETCH(cursor->ahead);
+    }
+    if (prefetchDistance <= 0) {
+        cursor->ahead = NULL;
+    }
+}
+
+/**
+ * LinkedListCursorNext() returns the cursor's current item and steps past it, or returns NULL once
+ * the end of the list has been reached.
+ *
+ * @param cursor A cursor set up by LinkedListCursorInit().
+ * @return The next item in the walk, or NULL when there are none left.
+ */
+ListItem *LinkedListCursorNext(ListCursor *cursor)
+{
+    ListItem *item = cursor->current;
+    if (item == NULL) {
+        return NULL;
+    }
+    if (cursor->direction == LIST_FORWARD) {
+        cursor->current = item->nextItem;
+        if (cursor->ahead != NULL) {
+            cursor->ahead = cursor->ahead->nextItem;
+        }
+    } else {
+        cursor->current = item->previousItem;
+        if (cursor->ahead != NULL) {
+            cursor->ahead = cursor->ahead->previousItem;
+        }
+    }
+    if (cursor->ahead != NULL) {
+        LINKEDLIST_PREFETCH(cursor->ahead);
+#ifdef LINKEDLIST_INLINE_DATA
+        //a short string is already in the item itself
+        if (!cursor->ahead->isInline) {
+            LINKEDLIST_PREFETCH(cursor->ahead->data);
+        }
+#else
+        LINKEDLIST_PREFETCH(cursor->ahead->data);
+#endif
+    }
+    return item;
+}
+
+/**
+ * LinkedListCompact() moves every item of a list into one freshly malloc()ed block, laid out in
+ * traversal order, so that walking the list afterwards touches memory sequentially. This restores
+ * locality after lots of LinkedListCreateAfter()/LinkedListRemove() churn. The data pointers are
+ * carried over unchanged.
+ *
+ * Every ListItem pointer into the old list is invalid once this returns a non-NULL head; only the
+ * returned head (and items reached from it) may be used. If the block can't be allocated, the old
+ * list is left exactly as it was and NULL is returned. Items in the block can be removed with
+ * LinkedListRemove() as usual, and the block is freed once the last one is gone. At most
+ * LINKEDLIST_MAX_BLOCKS blocks can be alive at once.
+ *
+ * @param list Any element in the list to compact.
+ * @return The head of the compacted list, or NULL if list was NULL or the block couldn't be
+ *         allocated.
+ */
+ListItem *LinkedListCompact(ListItem *list)
+{
+    LIST_TIMED_SCOPE(LIST_OP_COMPACT);
+    ListCursor cursor;
+    ListItem *block, *item;
+    int size, i;
+    if (list == NULL) {
+        return NULL;
+    }
+    list = LinkedListGetFirst(list);
+    size = LinkedListSize(list);
+    block = LinkedListAllocateBlock(size);
+    if (block == NULL) {
+        return NULL;
+    }
+    LinkedListForgetFinger();
+
+    //copy the data across in order and link the new items to their neighbors in the block
+    LinkedListCursorInit(&cursor, list, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    for (i = 0; i < size; i++) {
+        LinkedListCopyData(&block[i], LinkedListCursorNext(&cursor));
+        block[i].previousItem = (i > 0) ? &block[i - 1] : NULL;
+        block[i].nextItem = (i < size - 1) ? &block[i + 1] : NULL;
+    }
+
+    //the old items aren't linked to anything that survives, so they can simply be released
+    while (list != NULL) {
+        item = list->nextItem;
+        LinkedListRelease(list);
+        list = item;
     }
-    //list=list->nextItem;
-    printf("%s]\n", list->data);
+    return block;
+}
+
+/**
+ * LinkedListCopyOnWrite() is the copy-on-first-write path for constant lists declared with
+ * LINKEDLIST_CONSTANT_HEAD() and friends. If *list points into the constant list, the whole list is
+ * copied into freshly allocated ListItems (one block when a slot is free, see LinkedListCompact())
+ * and *list is moved to the copy of the item it pointed to. Otherwise *list is already writable
+ * and nothing happens, so this can be called before every change and only the first one pays.
+ *
+ * @param list[in,out] The item about to be changed.
+ * @param constant The constant list *list may point into.
+ * @param size The number of items in constant, see LINKEDLIST_CONSTANT_SIZE().
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or malloc() failed (*list is left
+ *         pointing into the constant list).
+ */
+int LinkedListCopyOnWrite(ListItem **list, const ListItem *constant, int size)
+{
+    LIST_TIMED_SCOPE(LIST_OP_COPY_ON_WRITE);
+    ListItem *block, *copy, *head = NULL, *tail = NULL;
+    int i;
+    if (list == NULL || *list == NULL || constant == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (*list < constant || *list >= constant + size) {
+        return SUCCESS;
+    }
+    //like LinkedListCreateAfterN(), fall back to one malloc() per item without a block
+    block = (size > 1) ? LinkedListAllocateBlock(size) : NULL;
+    for (i = 0; i < size; i++) {
+        copy = (block != NULL) ? &block[i] : LinkedListAllocate();
+        if (copy == NULL) {
+            while (head != NULL) {
+                copy = head->nextItem;
+                LinkedListRelease(head);
+                head = copy;
+            }
+            return STANDARD_ERROR;
+        }
+        LinkedListSetData(copy, constant[i].data);
+        copy->previousItem = tail;
+        copy->nextItem = NULL;
+        if (tail != NULL) {
+            tail->nextItem = copy;
+        } else {
+            head = copy;
+        }
+        tail = copy;
+    }
+    //walk the copy to the same position as *list
+    for (i = *list - constant; i > 0; i--) {
+        head = head->nextItem;
+    }
+    *list = head;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListSplitAfter() cuts a list in two directly after item, so item becomes the tail of the
+ * first list and the item that followed it becomes the head of the second. Only the two boundary
+ * pointers are rewritten, so this takes constant time. Splitting after the tail does nothing.
+ *
+ * @param item The item that will become the tail of the first list.
+ * @return The head of the second list, or NULL if item was NULL or already the tail.
+ */
+ListItem *LinkedListSplitAfter(ListItem *item)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SPLIT_AFTER);
+    ListItem *head;
+    if (item == NULL || item->nextItem == NULL) {
+        return NULL;
+    }
+    LinkedListForgetFinger();
+    head = item->nextItem;
+    item->nextItem = NULL;
+    head->previousItem = NULL;
+    return head;
+}
+
+/**
+ * LinkedListConcatenate() joins two separate lists by linking the tail of the first to the head of
+ * the second, in constant time. No ListItems are copied or allocated. The two lists must be
+ * different lists, since that can't be checked without walking them.
+ *
+ * @param tail The last item of the first list.
+ * @param head The first item of the second list.
+ * @return SUCCESS, or STANDARD_ERROR if either is NULL, tail isn't a tail or head isn't a head.
+ */
+int LinkedListConcatenate(ListItem *tail, ListItem *head)
+{
+    LIST_TIMED_SCOPE(LIST_OP_CONCATENATE);
+    if (tail == NULL || head == NULL || tail->nextItem != NULL || head->previousItem != NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListForgetFinger();
+    tail->nextItem = head;
+    head->previousItem = tail;
     return SUCCESS;
 }
 
+/**
+ * LinkedListSpliceAfter() moves the run of items from first to last (inclusive, following nextItem)
+ * out of whatever list it is in and links it in directly after item. Only the pointers at the
+ * boundaries of the run are rewritten, so this takes constant time no matter how long the run is.
+ * The items keep their addresses and data. last must be reachable from first by following nextItem,
+ * and item must not be inside the run; neither can be checked without walking the run.
+ *
+ * @param item The item the run will follow.
+ * @param first The first item of the run to move.
+ * @param last The last item of the run to move. May be the same as first.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListSpliceAfter(ListItem *item, ListItem *first, ListItem *last)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SPLICE_AFTER);
+    if (item == NULL || first == NULL || last == NULL) {
+        return STANDARD_ERROR;
+    }
+    //already in place
+    if (first->previousItem == item) {
+        return SUCCESS;
+    }
+    LinkedListForgetFinger();
 
+    //close the gap the run leaves behind
+    if (first->previousItem != NULL) {
+        first->previousItem->nextItem = last->nextItem;
+    }
+    if (last->nextItem != NULL) {
+        last->nextItem->previousItem = first->previousItem;
+    }
+
+    //link the run in after item
+    first->previousItem = item;
+    last->nextItem = item->nextItem;
+    if (item->nextItem != NULL) {
+        item->nextItem->previousItem = last;
+    }
+    item->nextItem = first;
+    return SUCCESS;
+}
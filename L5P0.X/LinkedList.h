@@ -9,7 +9,16 @@
  * (ListItems) and there is no separate construct to represent the entire list, each ListItem in it
  * does that implicitly.
  * ListItems can store pointers to strings, but the strings themselves must be stored somewhere else.
+ * ListArena.h can be that somewhere else when a list should own copies of its words.
  * This list supports NULL pointers as well.
+ *
+ * Built with LINKEDLIST_NODE_CACHE defined on the host, single ListItems come from the per-thread
+ * caches in ListNodeCache.h instead of straight from malloc(), so several threads can build and
+ * free lists of their own at the same time without fighting over the allocator. The finger and
+ * the allocation counter are then kept per thread and the heap accounting is updated atomically.
+ * LinkedListCompact(), LinkedListCreateAfterN() and LinkedListCopyOnWrite() share one table of
+ * blocks, so they (and freeing items in their blocks) must still only be used by one thread at a
+ * time.
  */
 
 /**
@@ -19,12 +28,68 @@
  * hold any type of pointer, even pointers to multi-dimensional arrays. This also means that any
  * data stored in a list item must first be allocated.
  */
+#ifdef LINKEDLIST_INLINE_DATA
+/**
+ * How many bytes (NUL included) of a string a ListItem keeps a copy of when the library is built
+ * with LINKEDLIST_INLINE_DATA. Can be overridden at build time.
+ */
+#ifndef LINKEDLIST_INLINE_BYTES
+#define LINKEDLIST_INLINE_BYTES 16
+#endif
+#endif
+
 typedef struct ListItem {
 	struct ListItem *previousItem;
 	struct ListItem *nextItem;
 	char *data;
+#ifdef LINKEDLIST_INLINE_DATA
+	char inlineData[LINKEDLIST_INLINE_BYTES]; //copy of data when it is short enough to fit
+	unsigned char isInline;
+#endif
 } ListItem;
 
+/**
+ * Reads an item's string for comparing or hashing. Built with LINKEDLIST_INLINE_DATA, every ListItem
+ * also keeps a copy of any string shorter than LINKEDLIST_INLINE_BYTES right inside itself, and
+ * this returns that copy, so reading a short word costs no second cache miss. Long strings (and
+ * NULL) are still read through data. data itself is never changed by this and always holds the
+ * pointer that was stored, so LinkedListRemove() and everything else see the caller's pointer as
+ * before. Without LINKEDLIST_INLINE_DATA this is just item->data.
+ *
+ * Because of the copy, stored strings must not be changed in place, and an item's data must be
+ * changed through LinkedListSetData() rather than assigned directly.
+ */
+#ifdef LINKEDLIST_INLINE_DATA
+#define LINKEDLIST_DATA(item) ((item)->isInline ? (item)->inlineData : (item)->data)
+#else
+#define LINKEDLIST_DATA(item) ((item)->data)
+#endif
+
+/**
+ * How many items ahead of the current one a ListCursor prefetches when the library walks a list.
+ * Can be overridden at build time.
+ */
+#ifndef LINKEDLIST_PREFETCH_DISTANCE
+#define LINKEDLIST_PREFETCH_DISTANCE 4
+#endif
+
+// Directions a ListCursor can walk in.
+enum {
+    LIST_BACKWARD = -1,
+    LIST_FORWARD = 1
+};
+
+/**
+ * A ListCursor walks a list one item at a time in either direction, prefetching items a fixed
+ * distance ahead of the one being returned. All of the library's own traversals use one. Set it up
+ * with LinkedListCursorInit() and step it with LinkedListCursorNext().
+ */
+typedef struct ListCursor {
+    ListItem *current;
+    ListItem *ahead;
+    int direction;
+} ListCursor;
+
 /**
  * This function starts a new linked list. Given an allocated pointer to data it will return a
  * pointer for a malloc()ed ListItem struct. If malloc() fails for any reason, then this function
@@ -67,6 +132,25 @@ int LinkedListSize(ListItem *list);
  */
 ListItem *LinkedListGetFirst(ListItem *list);
 
+/**
+ * LinkedListGetAt() returns the item at position index in a list, counting from 0 at the head. The
+ * library remembers where the last call landed (a "finger") and walks from whichever of the head,
+ * the finger or the tail (once a walk has found it) is closest, so stepping through a list by index,
+ * forwards, backwards or in small strides, costs O(1) per call instead of a walk from the head every
+ * time. Passing the head as list saves looking it up. Adding, removing or relinking items through
+ * this library, on any thread, makes it forget the finger, so it never points at an item that has
+ * moved or been freed. There is only one finger, so alternating between lists starts over each
+ * time, and it must not be used from more than one thread at once. Built with
+ * LINKEDLIST_NODE_CACHE, every thread has a finger of its own instead, but as any change on any
+ * thread still clears them all, stepping by index gets no faster than walking while other threads
+ * are changing lists.
+ *
+ * @param list Any element in the list, preferably its head.
+ * @param index The position of the item to return.
+ * @return The item at index, or NULL if list is NULL or index is out of range.
+ */
+ListItem *LinkedListGetAt(ListItem *list, int index);
+
 /**
  * This function allocates a new ListItem containing data and inserts it into the list directly
  * after item. It rearranges the pointers of other elements in the list to make this happen. If
@@ -80,6 +164,22 @@ ListItem *LinkedListGetFirst(ListItem *list);
  */
 ListItem *LinkedListCreateAfter(ListItem *item, char *data);
 
+/**
+ * LinkedListCreateAfterN() inserts k new ListItems holding data[0] to data[k - 1], in that order,
+ * directly after item. The k items are allocated together in one block (when a block slot is free,
+ * see LinkedListCompact()) and linked to each other before the run is spliced in, so the rest of
+ * the list only has its pointers rewritten once at each end of the run. If passed a NULL item the
+ * run becomes a new list of its own. If any allocation fails nothing is inserted and NULL is
+ * returned.
+ *
+ * @param item The ListItem that will be before the new items. Can be NULL.
+ * @param data The k data pointers to store. Any of them can be NULL.
+ * @param k How many items to create.
+ * @param last[out] If not NULL, where to store the last new item.
+ * @return The first new item, or NULL if data was NULL, k wasn't positive or malloc() failed.
+ */
+ListItem *LinkedListCreateAfterN(ListItem *item, char **data, int k, ListItem **last);
+
 /**
  * LinkedListSwapData() switches the data pointers of the two provided ListItems. This is most
  * useful when trying to reorder ListItems but when you want to preserve their location. It is used
@@ -95,20 +195,102 @@ ListItem *LinkedListCreateAfter(ListItem *item, char *data);
 int LinkedListSwapData(ListItem *firstItem, ListItem *secondItem);
 
 /**
- * LinkedListSort() performs a selection sort on list to sort the elements into decending order. It
+ * LinkedListSetData() changes the data stored in item, keeping its inline copy (see
+ * LINKEDLIST_DATA()) up to date.
+ *
+ * @param item The item to change.
+ * @param data The new data pointer. Can be NULL.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetData(ListItem *item, char *data);
+
+/**
+ * LinkedListSort() performs an insertion sort on list to sort the elements into ascending order. It
  * makes no guarantees of the addresses of the list items after sorting, so any ListItem referenced
  * before a call to LinkedListSort() and after may contain different data as only the data pointers
- * for the ListItems in the list are swapped. This function sorts the strings in ascending order
- * first by size (with NULL data pointers counting as 0-length strings) and then alphabetically
- * ascending order. So the list [dog, cat, duck, goat, NULL] will be sorted to [NULL, cat, dog,
- * duck, goat]. LinkedListSort() returns SUCCESS if sorting was possible. If passed a NULL pointer
- * for either argument, it will do nothing and return STANDARD_ERROR.
+ * for the ListItems in the list are swapped. No ListItems are created or freed, so sorting never
+ * touches the heap. This function sorts the strings in ascending order first by size (with NULL
+ * data pointers counting as 0-length strings) and then alphabetically ascending order. So the list
+ * [dog, cat, duck, goat, NULL] will be sorted to [NULL, cat, dog, duck, goat]. LinkedListSort()
+ * returns SUCCESS if sorting was possible. If passed a NULL pointer for either argument, it will
+ * do nothing and return STANDARD_ERROR.
  *
  * @param list Any element in the list to sort.
  * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
  */
 int LinkedListSort(ListItem *list);
 
+/**
+ * LinkedListCompare() orders two data pointers the way LinkedListSort() does: NULL first, then by
+ * length and then alphabetically.
+ *
+ * @param first One data pointer. Can be NULL.
+ * @param second Another data pointer. Can be NULL.
+ * @return Less than, equal to or greater than 0 if first sorts before, with or after second.
+ */
+int LinkedListCompare(const char *first, const char *second);
+
+/**
+ * How short a natural run can be before LinkedListSortNatural() tops it up by insertion. Can be
+ * overridden at build time.
+ */
+#ifndef LINKEDLIST_MIN_RUN
+#define LINKEDLIST_MIN_RUN 8
+#endif
+
+/**
+ * LinkedListSortNatural() sorts a list into the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically) but adapts to how ordered the list already is. It finds the runs
+ * that are already ascending (or strictly descending, which it reverses), tops short runs up to
+ * LINKEDLIST_MIN_RUN items by insertion, and merges neighbouring runs Timsort-style. An already
+ * sorted list costs a single pass, and a sorted list with a few items appended costs little more.
+ * The sort is stable and allocates nothing.
+ *
+ * Unlike LinkedListSort(), this relinks the ListItems instead of swapping their data, so every
+ * ListItem keeps its data but may end up at a different position; list may no longer be the head
+ * afterwards, so use LinkedListGetFirst() to find it.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR if passed a NULL pointer.
+ */
+int LinkedListSortNatural(ListItem *list);
+
+/**
+ * LinkedListPartitionNull() moves every item with NULL data to the front of a list, keeping the
+ * order of the NULL items and of the others. It works by relinking alone, in a single pass, so
+ * nothing is allocated or freed and every ListItem keeps its address and data. The relinking sorts
+ * do this as their first stage.
+ *
+ * @param list Any element in the list to partition.
+ * @return The new head of the list, or NULL if list was NULL.
+ */
+ListItem *LinkedListPartitionNull(ListItem *list);
+
+/**
+ * Called once per run of equal items by LinkedListSortAndCount(), with the data of the run's first
+ * item and the run's length. Returning STANDARD_ERROR stops the reporting.
+ */
+typedef int (*ListRunCallback)(char *data, int count, void *context);
+
+/**
+ * LinkedListSortAndCount() sorts a list exactly like LinkedListSortNatural() and reports every run
+ * of equal items in the sorted list to callback, in order, in the same pass that finishes the sort
+ * by rebuilding the backward links. That saves the separate LinkedListSize() and counting walks
+ * over the sorted list. Runs are reported as the data of their first item and their length, and a
+ * run of NULL items is reported with NULL data, just like SortedWordRunsForEach() in WordCount.c.
+ * If callback returns STANDARD_ERROR no more runs are reported, but the list is still completely
+ * sorted.
+ *
+ * @param list Any element in the list to sort.
+ * @param callback Called for each run of equal items, in sorted order.
+ * @param context Passed through to callback untouched.
+ * @param head[out] If not NULL, where to store the head of the sorted list.
+ * @return SUCCESS, or STANDARD_ERROR if list or callback is NULL or callback returned
+ *         STANDARD_ERROR.
+ */
+int LinkedListSortAndCount(ListItem *list, ListRunCallback callback, void *context,
+        ListItem **head);
+
 /**
  * LinkedListPrint() prints out the complete list to stdout. This function prints out the given
  * list, starting at the head if the provided pointer is not the head of the list, like "[STRING1,
@@ -120,4 +302,208 @@ int LinkedListSort(ListItem *list);
  */
 int LinkedListPrint(ListItem *list);
 
+/**
+ * LinkedListCursorInit() sets up cursor to walk the list starting at start (inclusive) in the given
+ * direction. The cursor keeps a second pointer prefetchDistance items further along and prefetches
+ * each item (and its string) as that pointer reaches it, so by the time LinkedListCursorNext()
+ * gets to an item it is hopefully already in cache. A prefetchDistance of 0 disables prefetching.
+ *
+ * Usage:
+ * ListCursor cursor;
+ * ListItem *item;
+ * LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD, 4);
+ * while ((item = LinkedListCursorNext(&cursor)) != NULL) { ... }
+ *
+ * @param cursor The cursor to set up.
+ * @param start The first item LinkedListCursorNext() will return. Can be NULL for an empty walk.
+ * @param direction LIST_FORWARD to follow nextItem, LIST_BACKWARD to follow previousItem.
+ * @param prefetchDistance How many items ahead of the current one to prefetch.
+ */
+void LinkedListCursorInit(ListCursor *cursor, ListItem *start, int direction, int prefetchDistance);
+
+/**
+ * LinkedListCursorNext() returns the cursor's current item and steps past it, or returns NULL once
+ * the end of the list has been reached.
+ *
+ * @param cursor A cursor set up by LinkedListCursorInit().
+ * @return The next item in the walk, or NULL when there are none left.
+ */
+ListItem *LinkedListCursorNext(ListCursor *cursor);
+
+/**
+ * LinkedListSplitAfter() cuts a list in two directly after item, so item becomes the tail of the
+ * first list and the item that followed it becomes the head of the second. Only the two boundary
+ * pointers are rewritten, so this takes constant time. Splitting after the tail does nothing.
+ *
+ * @param item The item that will become the tail of the first list.
+ * @return The head of the second list, or NULL if item was NULL or already the tail.
+ */
+ListItem *LinkedListSplitAfter(ListItem *item);
+
+/**
+ * LinkedListConcatenate() joins two separate lists by linking the tail of the first to the head of
+ * the second, in constant time. No ListItems are copied or allocated. The two lists must be
+ * different lists, since that can't be checked without walking them.
+ *
+ * @param tail The last item of the first list.
+ * @param head The first item of the second list.
+ * @return SUCCESS, or STANDARD_ERROR if either is NULL, tail isn't a tail or head isn't a head.
+ */
+int LinkedListConcatenate(ListItem *tail, ListItem *head);
+
+/**
+ * LinkedListSpliceAfter() moves the run of items from first to last (inclusive, following nextItem)
+ * out of whatever list it is in and links it in directly after item. Only the pointers at the
+ * boundaries of the run are rewritten, so this takes constant time no matter how long the run is.
+ * The items keep their addresses and data. last must be reachable from first by following nextItem,
+ * and item must not be inside the run; neither can be checked without walking the run.
+ *
+ * @param item The item the run will follow.
+ * @param first The first item of the run to move.
+ * @param last The last item of the run to move. May be the same as first.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListSpliceAfter(ListItem *item, ListItem *first, ListItem *last);
+
+/**
+ * LinkedListCompact() moves every item of a list into one freshly malloc()ed block, laid out in
+ * traversal order, so that walking the list afterwards touches memory sequentially. This restores
+ * locality after lots of LinkedListCreateAfter()/LinkedListRemove() churn. The data pointers are
+ * carried over unchanged.
+ *
+ * Every ListItem pointer into the old list is invalid once this returns a non-NULL head; only the
+ * returned head (and items reached from it) may be used. If the block can't be allocated, the old
+ * list is left exactly as it was and NULL is returned. Items in the block can be removed with
+ * LinkedListRemove() as usual, and the block is freed once the last one is gone. At most
+ * LINKEDLIST_MAX_BLOCKS blocks can be alive at once.
+ *
+ * @param list Any element in the list to compact.
+ * @return The head of the compacted list, or NULL if list was NULL or the block couldn't be
+ *         allocated.
+ */
+ListItem *LinkedListCompact(ListItem *list);
+
+/**
+ * Constant lists: a ListItem chain declared entirely at compile time, as a const array whose items
+ * are already linked to their neighbours, so it lives in flash (or .rodata on the host) and costs
+ * no malloc() at startup. Each item names the array and its own index:
+ *
+ *     static char ant[] = "ant", bee[] = "bee";
+ *     static const ListItem insects[] = {
+ *         LINKEDLIST_CONSTANT_HEAD(insects, ant),
+ *         LINKEDLIST_CONSTANT_ITEM(insects, 1, NULL),
+ *         LINKEDLIST_CONSTANT_TAIL(insects, 2, bee),
+ *     };
+ *
+ * The data must be constant expressions, such as string literals or the names of char arrays. A
+ * constant list needs at least 2 items. Functions that only read the list, such as
+ * LinkedListSize(), LinkedListGetFirst(), LinkedListPrint() and the word counts in WordCount.h,
+ * work on it directly through a cast to (ListItem *). Anything that changes or frees items must only
+ * be given the list after LinkedListCopyOnWrite().
+ */
+#define LINKEDLIST_CONSTANT_HEAD(list, item) \
+    {.previousItem = NULL, .nextItem = (ListItem *) &(list)[1], .data = (item)}
+#define LINKEDLIST_CONSTANT_ITEM(list, index, item) \
+    {.previousItem = (ListItem *) &(list)[(index) - 1], \
+    .nextItem = (ListItem *) &(list)[(index) + 1], .data = (item)}
+#define LINKEDLIST_CONSTANT_TAIL(list, index, item) \
+    {.previousItem = (ListItem *) &(list)[(index) - 1], .nextItem = NULL, .data = (item)}
+#define LINKEDLIST_CONSTANT_SIZE(list) ((int) (sizeof (list) / sizeof ((list)[0])))
+
+/**
+ * LinkedListCopyOnWrite() is the copy-on-first-write path for constant lists declared with
+ * LINKEDLIST_CONSTANT_HEAD() and friends. If *list points into the constant list, the whole list is
+ * copied into freshly allocated ListItems (one block when a slot is free, see LinkedListCompact())
+ * and *list is moved to the copy of the item it pointed to. Otherwise *list is already writable
+ * and nothing happens, so this can be called before every change and only the first one pays.
+ *
+ * @param list[in,out] The item about to be changed.
+ * @param constant The constant list *list may point into.
+ * @param size The number of items in constant, see LINKEDLIST_CONSTANT_SIZE().
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or malloc() failed (*list is left
+ *         pointing into the constant list).
+ */
+int LinkedListCopyOnWrite(ListItem **list, const ListItem *constant, int size);
+
+/**
+ * LinkedListAllocationCount() returns how many ListItems this library has malloc()ed since the last
+ * call to LinkedListResetAllocationCount() (or since startup). LinkedListSwapData(),
+ * LinkedListSort(), LinkedListSize(), LinkedListGetFirst() and LinkedListPrint() never allocate, so
+ * tests can reset the counter, run them over a list and check that it is still 0. Built with
+ * LINKEDLIST_NODE_CACHE, it counts the calling thread's allocations only, cached items included.
+ *
+ * @return The number of ListItem allocations.
+ */
+unsigned int LinkedListAllocationCount(void);
+
+/**
+ * LinkedListResetAllocationCount() sets the allocation counter back to 0.
+ */
+void LinkedListResetAllocationCount(void);
+
+/**
+ * How much memory a list takes, from LinkedListMemoryUsage().
+ */
+typedef struct ListMemoryUsage {
+    unsigned long items; //number of ListItems
+    unsigned long itemBytes; //items * sizeof (ListItem)
+    unsigned long overheadBytes; //estimated malloc() headers and padding, and unused block slots
+    unsigned long stringBytes; //the strings, if they were asked for
+} ListMemoryUsage;
+
+/**
+ * LinkedListMemoryUsage() reports how much memory a list takes. Items that live in a block share
+ * its malloc() chunk, so the block's header and any of its slots not in this list are counted as
+ * overhead; a block shared with another list is counted by both.
+ *
+ * @param list Any element in the list to measure.
+ * @param countStrings TRUE to also add up the strings the items point to (NUL included), for lists
+ *                     that own their strings.
+ * @param usage Where to store the results.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListMemoryUsage(ListItem *list, int countStrings, ListMemoryUsage *usage);
+
+/**
+ * LinkedListHeapInUse() returns how many bytes of heap the library's ListItems hold right now,
+ * estimated allocator overhead included. Built with LINKEDLIST_NODE_CACHE, items waiting in the
+ * node caches still count until they go back to free().
+ *
+ * @return The bytes in use.
+ */
+unsigned long LinkedListHeapInUse(void);
+
+/**
+ * LinkedListHeapHighWater() returns the most heap the library's ListItems have held at once since
+ * startup or the last LinkedListResetHeapHighWater(), counted like LinkedListHeapInUse().
+ *
+ * @return The high-water mark in bytes.
+ */
+unsigned long LinkedListHeapHighWater(void);
+
+/**
+ * LinkedListResetHeapHighWater() brings the high-water mark down to what is in use right now.
+ */
+void LinkedListResetHeapHighWater(void);
+
+/**
+ * LinkedListSetHeapLimit() sets how much heap LinkedListCanInsert() lets ListItems use. It starts
+ * as LINKEDLIST_HEAP_LIMIT: 1024 bytes (the board's whole heap) on the board, and no limit on the
+ * host, where it can be set to plan for the board.
+ *
+ * @param bytes The limit in bytes, or 0 for no limit.
+ */
+void LinkedListSetHeapLimit(unsigned long bytes);
+
+/**
+ * LinkedListCanInsert() predicts whether n more LinkedListCreateAfter() calls will fit within the
+ * heap limit, given what ListItems already use. The prediction assumes one malloc() per item, so a
+ * block from LinkedListCreateAfterN() needs no more than predicted. It can't account for anything
+ * else on the heap, so leave room for that in the limit.
+ *
+ * @param n How many items are about to be inserted.
+ * @return TRUE if they are expected to fit (always, with no limit), FALSE if not or n is negative.
+ */
+int LinkedListCanInsert(int n);
+
 #endif
@@ -13,7 +13,31 @@
 
 // User libraries
 #include "LinkedList.h"
+#include "ListSnapshot.h"
+#include "ListArena.h"
+#include "ListTokenizer.h"
+#include "ListMultiset.h"
+#include "ListPipeline.h"
+#include "ListArray.h"
 #define MIDDLE
+#define NO_ALLOC
+#define CURSOR
+#define COMPACT
+#define SPLICE
+#define NATURAL_SORT
+#define SNAPSHOT
+#define CREATE_AFTER_N
+#define INLINE_DATA
+#define ARENA
+#define GET_AT
+#define SORT_AND_COUNT
+#define TOKENIZE
+#define MULTISET
+#define PIPELINE
+#define ARRAY
+#define PARTITION_NULL
+#define CONSTANT
+#define MEMORY
 // **** Set any macros or preprocessor directives here ****
 
 // **** Declare any data types here ****
@@ -21,6 +45,9 @@
 // **** Define any module-level, global, or external variables here ****
 
 // **** Declare any function prototypes here ****
+static int PrintRun(char *data, int count, void *context);
+static char *DataAt(ListItem *list, int index);
+static void FreeList(ListItem *list);
 
 int main()
 {
@@ -40,6 +67,8 @@ int main()
     static char *homes = "homes";
     static char *horse = "horse";
     static char *hersh = "hersh";
+    static char *india = "india";
+    static char *juliett = "juliett";
 
     ListItem *testList;
     int status;
@@ -105,7 +134,342 @@ LinkedListCreateAfter(testList, bravo);
     status = LinkedListPrint(testList);
     printf("Print status: %u\n", status);
 #endif
+
+#ifdef NO_ALLOC
+    //allocation-free test: swap, sort, size, get first and print must never malloc()
+    int run;
+    LinkedListResetAllocationCount();
+    for (run = 0; run < 100; run++) {
+        LinkedListSwapData(LinkedListGetFirst(testList), testList);
+        LinkedListSort(testList);
+        LinkedListSize(testList);
+    }
+    status = LinkedListPrint(testList);
+    printf("Print status: %u\n", status);
+    printf("Allocations: %u (expected 0)\n", LinkedListAllocationCount());
+#endif
+
+#ifdef CURSOR
+    //cursor test: walk the list backwards from its tail, prefetching 2 items ahead
+    ListCursor cursor;
+    ListItem *item, *tail = NULL;
+    LinkedListCursorInit(&cursor, testList, LIST_FORWARD, 2);
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        tail = item;
+    }
+    LinkedListCursorInit(&cursor, tail, LIST_BACKWARD, 2);
+    printf("Backwards: [");
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        printf(" %s", item->data);
+    }
+    printf(" ]\n");
+#endif
+
+#ifdef COMPACT
+    //compaction test: churn the list so its items are scattered, then compact it
+    int churn;
+    for (churn = 0; churn < 5; churn++) {
+        LinkedListRemove(LinkedListCreateAfter(LinkedListGetFirst(testList), golf));
+        LinkedListCreateAfter(LinkedListGetFirst(testList)->nextItem, homes);
+    }
+    testList = LinkedListCompact(testList);
+    status = LinkedListPrint(testList);
+    printf("Compact print status: %u\n", status);
+    LinkedListRemove(testList->nextItem);
+    status = LinkedListPrint(testList);
+    printf("Remove after compact print status: %u\n", status);
+#endif
+
+#ifdef SPLICE
+    //split/concatenate/splice test: these only relink, so nothing is allocated
+    ListItem *secondHalf, *firstTail;
+    LinkedListResetAllocationCount();
+    testList = LinkedListGetFirst(testList);
+    firstTail = testList->nextItem->nextItem;
+    secondHalf = LinkedListSplitAfter(firstTail);
+    LinkedListPrint(testList);
+    LinkedListPrint(secondHalf);
+    status = LinkedListConcatenate(firstTail, secondHalf);
+    printf("Concatenate status: %u\n", status);
+    status = LinkedListSpliceAfter(secondHalf->nextItem->nextItem, testList, testList->nextItem);
+    printf("Splice status: %u\n", status);
+    testList = LinkedListGetFirst(secondHalf);
+    LinkedListPrint(testList);
+    printf("Allocations: %u (expected 0)\n", LinkedListAllocationCount());
+#endif
+
+#ifdef NATURAL_SORT
+    //natural sort test: sort, append a few items, then sort the nearly-sorted list again
+    status = LinkedListSortNatural(testList);
+    printf("Natural sort status: %u\n", status);
+    testList = LinkedListGetFirst(testList);
+    LinkedListCreateAfter(testList, charlie);
+    LinkedListCreateAfter(testList, NULL);
+    status = LinkedListSortNatural(testList);
+    printf("Natural sort status: %u\n", status);
+    testList = LinkedListGetFirst(testList);
+    status = LinkedListPrint(testList);
+    printf("Print status: %u\n", status);
+#endif
+
+#ifdef SNAPSHOT
+    //snapshot test: encode the list into a buffer and read it back without rebuilding it
+    static uint32_t snapshotBuffer[128];
+    ListSnapshot snapshot;
+    status = ListSnapshotEncode(testList, snapshotBuffer, sizeof (snapshotBuffer));
+    printf("Snapshot encode status: %u\n", status);
+    status = ListSnapshotView(&snapshot, snapshotBuffer, ListSnapshotEncodedSize(testList));
+    printf("Snapshot view status: %u\n", status);
+    printf("Snapshot size: %d (expected %d)\n", ListSnapshotSize(&snapshot), LinkedListSize(testList));
+    status = ListSnapshotPrint(&snapshot);
+    printf("Snapshot print status: %u\n", status);
+    //link the last record back to the first, which has to be caught before anything walks it
+    ListSnapshotRecord *lastRecord = (ListSnapshotRecord *) ((char *) snapshotBuffer
+            + sizeof (ListSnapshotHeader)) + LinkedListSize(testList) - 1;
+    lastRecord->nextItem = 0;
+    status = ListSnapshotView(&snapshot, snapshotBuffer, ListSnapshotEncodedSize(testList));
+    printf("Snapshot view status with a cycle: %d (expected %d)\n", status, STANDARD_ERROR);
+    lastRecord->nextItem = LIST_SNAPSHOT_NONE;
+#endif
+
+#ifdef CREATE_AFTER_N
+    //batch insert test: 3 items in one block, spliced in after the head
+    char *batch[] = {india, NULL, juliett};
+    ListItem *batchLast;
+    ListItem *batchFirst = LinkedListCreateAfterN(LinkedListGetFirst(testList), batch, 3, &batchLast);
+    printf("Batch first: %s, last: %s\n", batchFirst != NULL ? batchFirst->data : "(failed)",
+            batchFirst != NULL ? batchLast->data : "(failed)");
+    status = LinkedListPrint(testList);
+    printf("Print status: %u\n", status);
+#endif
+
+#ifdef INLINE_DATA
+    //inline data test: data keeps the stored pointer whether or not a copy is kept inline
+    ListItem *inlineItem = LinkedListGetFirst(testList)->nextItem;
+    status = LinkedListSetData(inlineItem, juliett);
+    printf("Set data status: %u, same pointer: %d, read back: %s\n", status,
+            inlineItem->data == juliett, LINKEDLIST_DATA(inlineItem));
+    status = LinkedListSwapData(inlineItem, inlineItem->nextItem);
+    printf("Swap status: %u, read back: %s, %s\n", status, LINKEDLIST_DATA(inlineItem),
+            LINKEDLIST_DATA(inlineItem->nextItem));
+    status = LinkedListSort(testList);
+    printf("Sort status: %u, removed pointer is stored one: %d\n", status,
+            LinkedListRemove(LinkedListCreateAfter(testList, hotel)) == hotel);
+    status = LinkedListPrint(testList);
+    printf("Print status: %u\n", status);
+#endif
+
+#ifdef ARENA
+    //arena test: build a list of copied words, one long enough to need a chunk of its own
+    ListArena arena;
+    char word[] = "kilo";
+    ListItem *arenaList;
+    status = ListArenaInit(&arena, 16);
+    printf("Arena init status: %u\n", status);
+    arenaList = ListArenaCreateAfter(&arena, NULL, word);
+    word[0] = 'L'; //the list keeps its own copy
+    ListArenaCreateAfter(&arena, ListArenaCreateAfter(&arena, arenaList, NULL), "lima-mike-november");
+    status = LinkedListPrint(arenaList);
+    printf("Print status: %u, arena bytes: %lu\n", status, ListArenaSize(&arena));
+    while (arenaList != NULL) {
+        ListItem *next = arenaList->nextItem;
+        LinkedListRemove(arenaList);
+        arenaList = next;
+    }
+    ListArenaFree(&arena);
+    printf("Arena bytes after free: %lu\n", ListArenaSize(&arena));
+#endif
+
+#ifdef GET_AT
+    //index test: forwards, then backwards from the finger, then past the end
+    testList = LinkedListGetFirst(testList);
+    printf("Item 7: %s, item 9: %s, item 8: %s\n", DataAt(testList, 7), DataAt(testList, 9),
+            DataAt(testList, 8));
+    printf("Last item: %s, past the end: %p\n", DataAt(testList, LinkedListSize(testList) - 1),
+            (void *) LinkedListGetAt(testList, LinkedListSize(testList)));
+#endif
+
+#ifdef SORT_AND_COUNT
+    //fused sort and count test: the runs come out of the pass that finishes the sort
+    LinkedListCreateAfter(testList, golf);
+    status = LinkedListSortAndCount(testList, PrintRun, NULL, &testList);
+    printf("\nSort and count status: %u\n", status);
+    status = LinkedListPrint(testList);
+    printf("Print status: %u\n", status);
+#endif
+
+    //the sections below build lists of their own, and the heap is small, so give this one back
+    FreeList(testList);
+    testList = NULL;
+
+#ifdef TOKENIZE
+    //tokenizer test: split and lowercase raw text in place, the words point into text
+    char text[] = "The quick, BROWN fox -- jumps over the lazy dog's back";
+    ListItem *wordList = NULL;
+    status = ListTokenize(text, strlen(text), LIST_TOKENIZE_FOLD_CASE, &wordList);
+    printf("Tokenize status: %u, words: %d\n", status, LinkedListSize(wordList));
+    status = LinkedListPrint(wordList);
+    printf("Print status: %u\n", status);
+    FreeList(wordList);
+#endif
+#ifdef MULTISET
+    //multiset test: repeats collapse into counts, sorting and counting only touch distinct words
+    char *fox = "fox", *dog = "dog", *ant = "ant";
+    char *multisetWords[] = {fox, dog, fox, NULL, ant, fox, dog};
+    ListItem *multisetList = NULL, *expanded;
+    ListMultiset multiset;
+    ListMultisetItem *foxItem;
+    int multisetCount[7], occurrence;
+    for (occurrence = 0; occurrence < 7; occurrence++) {
+        multisetList = LinkedListCreateAfter(multisetList, multisetWords[occurrence]);
+    }
+    ListMultisetInit(&multiset);
+    status = ListMultisetFromList(&multiset, multisetList);
+    foxItem = ListMultisetFind(&multiset, "fox");
+    printf("Multiset status: %u, distinct: %d, total: %d, fox: %d\n", status, multiset.distinct,
+            multiset.total, foxItem != NULL ? foxItem->count : 0);
+    ListMultisetSort(&multiset);
+    status = ListMultisetWordCount(&multiset, multisetCount);
+    printf("Word count status: %u, counts:", status);
+    for (occurrence = 0; occurrence < 7; occurrence++) {
+        printf(" %d", multisetCount[occurrence]);
+    }
+    expanded = ListMultisetToList(&multiset);
+    printf("\nExpanded size: %d\n", LinkedListSize(expanded));
+    status = LinkedListPrint(expanded);
+    printf("Print status: %u\n", status);
+    FreeList(expanded);
+    FreeList(multisetList);
+    ListMultisetFree(&multiset);
+#endif
+#ifdef PIPELINE
+    //pipeline test: build and count at once, in small batches so the ring is handed over often
+    char pipelineText[] = "the cat and the dog and the bird";
+    ListItem *pipelineList = NULL;
+    ListMultiset pipelineCounts;
+    ListMultisetItem *theItem;
+    ListMultisetInit(&pipelineCounts);
+    status = ListPipelineIngest(pipelineText, strlen(pipelineText), 0, 2, &pipelineList,
+            &pipelineCounts);
+    theItem = ListMultisetFind(&pipelineCounts, "the");
+    printf("Pipeline status: %u, words: %d, distinct: %d, the: %d\n", status,
+            LinkedListSize(pipelineList), pipelineCounts.distinct,
+            theItem != NULL ? theItem->count : 0);
+    status = LinkedListPrint(pipelineList);
+    printf("Print status: %u\n", status);
+    FreeList(pipelineList);
+    ListMultisetFree(&pipelineCounts);
+#endif
+#ifdef ARRAY
+    //struct-of-arrays test: the scans run over length[], sorting relinks the node IDs
+    char *arrayWords[] = {"pear", NULL, "fig", "apple", NULL, "kiwi"};
+    ListArray wordArray;
+    int node = LIST_ARRAY_NONE, arrayWord;
+    ListArrayInit(&wordArray, 4);
+    for (arrayWord = 0; arrayWord < 6; arrayWord++) {
+        node = ListArrayCreateAfter(&wordArray, node, arrayWords[arrayWord]);
+    }
+    printf("Array size: %d, NULLs: %d, total length: %lu, sorted: %d\n", ListArraySize(&wordArray),
+            ListArrayCountNull(&wordArray), ListArrayTotalLength(&wordArray),
+            ListArrayIsSorted(&wordArray));
+    printf("Removed: %s\n", ListArrayRemove(&wordArray, ListArrayGetAt(&wordArray, 2)));
+    status = ListArraySort(&wordArray);
+    printf("Sort status: %u, sorted: %d\n", status, ListArrayIsSorted(&wordArray));
+    status = ListArrayPrint(&wordArray);
+    printf("Print status: %u\n", status);
+    ListArrayFree(&wordArray);
+#endif
+#ifdef PARTITION_NULL
+    //NULL partition test: NULLs move to the front by relinking, so nothing is allocated
+    char *partitionWords[] = {"one", NULL, "two", NULL, "three"};
+    ListItem *partitionList = NULL, *partitionTail;
+    int partitionWord;
+    for (partitionWord = 0; partitionWord < 5; partitionWord++) {
+        partitionList = LinkedListCreateAfter(partitionList, partitionWords[partitionWord]);
+    }
+    LinkedListResetAllocationCount();
+    partitionList = LinkedListPartitionNull(partitionList);
+    partitionTail = LinkedListGetAt(partitionList, 4);
+    printf("Partition allocations: %u, tail kept: %d\n", LinkedListAllocationCount(),
+            partitionTail != NULL && partitionTail->data == partitionWords[4]);
+    status = LinkedListPrint(partitionList);
+    printf("Print status: %u\n", status);
+    FreeList(partitionList);
+#endif
+#ifdef CONSTANT
+    //constant list test: read in place, then copied on the first change
+    static const ListItem constantList[] = {
+        LINKEDLIST_CONSTANT_HEAD(constantList, "zeta"),
+        LINKEDLIST_CONSTANT_ITEM(constantList, 1, NULL),
+        LINKEDLIST_CONSTANT_TAIL(constantList, 2, "eta"),
+    };
+    ListItem *constantItem = (ListItem *) &constantList[2];
+    LinkedListResetAllocationCount();
+    printf("Constant size: %d, allocations: %u\n", LinkedListSize(constantItem),
+            LinkedListAllocationCount());
+    status = LinkedListCopyOnWrite(&constantItem, constantList,
+            LINKEDLIST_CONSTANT_SIZE(constantList));
+    printf("Copy status: %u, copied: %d, allocations: %u\n", status,
+            constantItem != &constantList[2], LinkedListAllocationCount());
+    status = LinkedListCopyOnWrite(&constantItem, constantList,
+            LINKEDLIST_CONSTANT_SIZE(constantList));
+    printf("Second copy status: %u, allocations: %u\n", status, LinkedListAllocationCount());
+    LinkedListSortNatural(constantItem);
+    status = LinkedListPrint(constantItem);
+    printf("Print status: %u\n", status);
+    if (constantItem != &constantList[2]) {
+        FreeList(constantItem);
+    }
+#endif
+#ifdef MEMORY
+    //memory accounting test: measure a small list and check the admission estimate against a limit
+    ListMemoryUsage usage;
+    ListItem *memoryList = LinkedListCreateAfter(LinkedListNew("left"), "right");
+    status = LinkedListMemoryUsage(memoryList, TRUE, &usage);
+    printf("Memory status: %u, items: %lu, item bytes: %lu, overhead: %lu, strings: %lu\n", status,
+            usage.items, usage.itemBytes, usage.overheadBytes, usage.stringBytes);
+    printf("Heap in use: %lu, high water: %lu\n", LinkedListHeapInUse(), LinkedListHeapHighWater());
+    LinkedListSetHeapLimit(LinkedListHeapInUse());
+    printf("Can insert 0: %d, 1: %d\n", LinkedListCanInsert(0), LinkedListCanInsert(1));
+    LinkedListSetHeapLimit(0);
+    FreeList(memoryList);
+    printf("Heap in use after free: %lu\n", LinkedListHeapInUse());
+#endif
     // You can never return from main() in an embedded system (one that lacks an operating system).
     // This will result in the processor restarting, which is almost certainly not what you want!
     while (1);
-}
\ No newline at end of file
+}
+
+/*
+ * ListRunCallback for the fused sort and count test.
+ */
+static int PrintRun(char *data, int count, void *context)
+{
+    (void) context;
+    printf("%s=%d ", data, count);
+    return SUCCESS;
+}
+
+/*
+ * Returns the data of the item at index, or "(missing)" if there is no such item, so a failed
+ * lookup shows up in the output instead of crashing the test.
+ */
+static char *DataAt(ListItem *list, int index)
+{
+    ListItem *item = LinkedListGetAt(list, index);
+    return (item != NULL) ? item->data : "(missing)";
+}
+
+/*
+ * Removes and frees every item of a list. The data is left alone.
+ */
+static void FreeList(ListItem *list)
+{
+    ListItem *next;
+    list = LinkedListGetFirst(list);
+    while (list != NULL) {
+        next = list->nextItem;
+        LinkedListRemove(list);
+        list = next;
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * File:   ListArena.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ListArena.h"
+#include "BOARD.h"
+
+/*
+ * Allocates an empty chunk able to hold size bytes of words.
+ */
+static ListArenaChunk *ListArenaNewChunk(unsigned long size)
+{
+    ListArenaChunk *chunk = malloc(sizeof (ListArenaChunk) + size);
+    if (chunk != NULL) {
+        chunk->next = NULL;
+        chunk->size = size;
+        chunk->used = 0;
+    }
+    return chunk;
+}
+
+/**
+ * ListArenaInit() prepares an empty arena. Nothing is allocated until the first word is copied in.
+ *
+ * @param arena The arena to set up.
+ * @param chunkSize How many bytes of words each chunk holds. Longer words get a chunk of their own.
+ * @return SUCCESS or STANDARD_ERROR if arena is NULL or chunkSize is 0.
+ */
+int ListArenaInit(ListArena *arena, unsigned long chunkSize)
+{
+    if (arena == NULL || chunkSize == 0) {
+        return STANDARD_ERROR;
+    }
+    arena->chunks = NULL;
+    arena->chunkSize = chunkSize;
+    return SUCCESS;
+}
+
+/**
+ * ListArenaCopy() copies a word into the arena.
+ *
+ * @param arena An initialized arena.
+ * @param word The word to copy.
+ * @return The copy, which stays valid until ListArenaFree(), or NULL if word or arena is NULL or
+ *         malloc() failed.
+ */
+char *ListArenaCopy(ListArena *arena, const char *word)
+{
+    ListArenaChunk *chunk;
+    unsigned long length;
+    char *copy;
+    if (arena == NULL || word == NULL) {
+        return NULL;
+    }
+    length = strlen(word) + 1;
+    chunk = arena->chunks;
+    if (length > arena->chunkSize) {
+        //a word too long for a normal chunk gets one of its own, kept behind the current chunk so
+        //that chunk can go on filling up
+        chunk = ListArenaNewChunk(length);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        if (arena->chunks != NULL) {
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        } else {
+            arena->chunks = chunk;
+        }
+    } else if (chunk == NULL || chunk->size - chunk->used < length) {
+        chunk = ListArenaNewChunk(arena->chunkSize);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    copy = chunk->words + chunk->used;
+    memcpy(copy, word, length);
+    chunk->used += length;
+    return copy;
+}
+
+/**
+ * ListArenaCreateAfter() works like LinkedListCreateAfter() but stores a copy of word, made in the
+ * arena, instead of word itself. A NULL word is stored as NULL.
+ *
+ * @param arena An initialized arena.
+ * @param item The ListItem that will be before the new one. Can be NULL to start a new list.
+ * @param word The word to copy into the new ListItem. Can be NULL.
+ * @return The new ListItem, or NULL if arena is NULL or malloc() failed.
+ */
+ListItem *ListArenaCreateAfter(ListArena *arena, ListItem *item, const char *word)
+{
+    char *copy = NULL;
+    if (arena == NULL) {
+        return NULL;
+    }
+    if (word != NULL) {
+        copy = ListArenaCopy(arena, word);
+        if (copy == NULL) {
+            return NULL;
+        }
+    }
+    //if this fails the copy just stays unused in the arena until it's freed
+    return LinkedListCreateAfter(item, copy);
+}
+
+/**
+ * ListArenaSize() returns how many bytes the arena has malloc()ed for words, chunk headers
+ * included.
+ *
+ * @param arena An initialized arena.
+ * @return The arena's size in bytes, or 0 if arena is NULL.
+ */
+unsigned long ListArenaSize(const ListArena *arena)
+{
+    ListArenaChunk *chunk;
+    unsigned long size = 0;
+    if (arena == NULL) {
+        return 0;
+    }
+    for (chunk = arena->chunks; chunk != NULL; chunk = chunk->next) {
+        size += sizeof (ListArenaChunk) + chunk->size;
+    }
+    return size;
+}
+
+/**
+ * ListArenaFree() frees every word in the arena at once. Every pointer it handed out becomes
+ * invalid, so the lists using them must not read their data afterwards. The arena is empty
+ * afterwards and can be reused.
+ *
+ * @param arena The arena to free.
+ */
+void ListArenaFree(ListArena *arena)
+{
+    ListArenaChunk *next;
+    if (arena == NULL) {
+        return;
+    }
+    while (arena->chunks != NULL) {
+        next = arena->chunks->next;
+        free(arena->chunks);
+        arena->chunks = next;
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef LISTARENA_H
+#define LISTARENA_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * An optional string arena for lists that should own their words. A list only stores pointers, so a
+ * caller building a list from words it doesn't keep around otherwise (read from a file, typed in,
+ * ...) would have to malloc() and later free() every word on its own. Instead, ListArenaCopy() and
+ * ListArenaCreateAfter() copy words into large chunks, one after another, and ListArenaFree() gives
+ * back every word in the arena at once, in time proportional to the number of chunks.
+ *
+ * There is no list object to attach the arena to, so it simply lives alongside the list it holds
+ * the words of, and is freed when that list is done with. Words can't be freed one at a time;
+ * LinkedListRemove()ing an item just leaves its word in the arena until the arena is freed.
+ *
+ * Usage:
+ * ListArena arena;
+ * ListItem *list = NULL;
+ * ListArenaInit(&arena, LIST_ARENA_CHUNK_SIZE);
+ * while (...) {
+ *     list = ListArenaCreateAfter(&arena, list, buffer);
+ * }
+ * ...
+ * // remove the items, then
+ * ListArenaFree(&arena);
+ */
+
+// Default size of each chunk of words, in bytes. Keep it small on the board, the heap is tiny.
+#ifndef LIST_ARENA_CHUNK_SIZE
+#define LIST_ARENA_CHUNK_SIZE 256
+#endif
+
+/**
+ * One malloc()ed chunk of words.
+ */
+typedef struct ListArenaChunk {
+    struct ListArenaChunk *next;
+    unsigned long size; //bytes in words
+    unsigned long used;
+    char words[];
+} ListArenaChunk;
+
+/**
+ * An arena of words. Set it up with ListArenaInit().
+ */
+typedef struct ListArena {
+    ListArenaChunk *chunks; //newest (and the one being filled) first
+    unsigned long chunkSize;
+} ListArena;
+
+/**
+ * ListArenaInit() prepares an empty arena. Nothing is allocated until the first word is copied in.
+ *
+ * @param arena The arena to set up.
+ * @param chunkSize How many bytes of words each chunk holds. Longer words get a chunk of their own.
+ * @return SUCCESS or STANDARD_ERROR if arena is NULL or chunkSize is 0.
+ */
+int ListArenaInit(ListArena *arena, unsigned long chunkSize);
+
+/**
+ * ListArenaCopy() copies a word into the arena.
+ *
+ * @param arena An initialized arena.
+ * @param word The word to copy.
+ * @return The copy, which stays valid until ListArenaFree(), or NULL if word or arena is NULL or
+ *         malloc() failed.
+ */
+char *ListArenaCopy(ListArena *arena, const char *word);
+
+/**
+ * ListArenaCreateAfter() works like LinkedListCreateAfter() but stores a copy of word, made in the
+ * arena, instead of word itself. A NULL word is stored as NULL.
+ *
+ * @param arena An initialized arena.
+ * @param item The ListItem that will be before the new one. Can be NULL to start a new list.
+ * @param word The word to copy into the new ListItem. Can be NULL.
+ * @return The new ListItem, or NULL if arena is NULL or malloc() failed.
+ */
+ListItem *ListArenaCreateAfter(ListArena *arena, ListItem *item, const char *word);
+
+/**
+ * ListArenaSize() returns how many bytes the arena has malloc()ed for words, chunk headers
+ * included.
+ *
+ * @param arena An initialized arena.
+ * @return The arena's size in bytes, or 0 if arena is NULL.
+ */
+unsigned long ListArenaSize(const ListArena *arena);
+
+/**
+ * ListArenaFree() frees every word in the arena at once. Every pointer it handed out becomes
+ * invalid, so the lists using them must not read their data afterwards. The arena is empty
+ * afterwards and can be reused.
+ *
+ * @param arena The arena to free.
+ */
+void ListArenaFree(ListArena *arena);
+
+#endif
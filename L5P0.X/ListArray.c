@@ -0,0 +1,524 @@
+/*
+ * File:   ListArray.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ListArray.h"
+#include "BOARD.h"
+
+/*
+ * Whether node is the ID of a node in the list.
+ */
+static int ListArrayIsNode(const ListArray *array, int node)
+{
+    return node >= 0 && node < array->used && array->length[node] != LIST_ARRAY_FREE_LENGTH;
+}
+
+/*
+ * The length[] code for data.
+ */
+static int ListArrayLengthOf(const char *data)
+{
+    return (data == NULL) ? LIST_ARRAY_NULL_LENGTH : (int) strlen(data);
+}
+
+/*
+ * Doubles every array. If one of them can't grow, the capacity stays the same (the ones that did
+ * grow just have unused room).
+ */
+static int ListArrayGrow(ListArray *array)
+{
+    int capacity = array->capacity * 2;
+    void *grown;
+    if ((grown = realloc(array->next, capacity * sizeof (int))) == NULL) {
+        return STANDARD_ERROR;
+    }
+    array->next = grown;
+    if ((grown = realloc(array->previous, capacity * sizeof (int))) == NULL) {
+        return STANDARD_ERROR;
+    }
+    array->previous = grown;
+    if ((grown = realloc(array->data, capacity * sizeof (char *))) == NULL) {
+        return STANDARD_ERROR;
+    }
+    array->data = grown;
+    if ((grown = realloc(array->length, capacity * sizeof (int))) == NULL) {
+        return STANDARD_ERROR;
+    }
+    array->length = grown;
+    array->capacity = capacity;
+    return SUCCESS;
+}
+
+/*
+ * Compares two nodes like LinkedListCompare() does their data, but with the cached lengths. NULLs
+ * have the lowest length code, so they still come first, and two NULLs (or two "") are equal
+ * without reading anything.
+ */
+static int ListArrayCompareNodes(const ListArray *array, int first, int second)
+{
+    int length1 = array->length[first], length2 = array->length[second];
+    if (length1 != length2) {
+        return (length1 < length2) ? -1 : 1;
+    }
+    if (length1 <= 0) {
+        return 0;
+    }
+    return strcmp(array->data[first], array->data[second]);
+}
+
+/*
+ * Stably merges two sorted chains linked through next[] only.
+ */
+static int ListArrayMerge(ListArray *array, int first, int second)
+{
+    int head = LIST_ARRAY_NONE, tail = LIST_ARRAY_NONE, taken;
+    while (first != LIST_ARRAY_NONE && second != LIST_ARRAY_NONE) {
+        //ties go to the first chain, which keeps the merge stable
+        if (ListArrayCompareNodes(array, first, second) <= 0) {
+            taken = first;
+            first = array->next[first];
+        } else {
+            taken = second;
+            second = array->next[second];
+        }
+        if (tail == LIST_ARRAY_NONE) {
+            head = taken;
+        } else {
+            array->next[tail] = taken;
+        }
+        tail = taken;
+    }
+    taken = (first != LIST_ARRAY_NONE) ? first : second;
+    if (tail == LIST_ARRAY_NONE) {
+        return taken;
+    }
+    array->next[tail] = taken;
+    return head;
+}
+
+/*
+ * Merge sorts the first length nodes of the chain starting at head, linked through next[] only.
+ */
+static int ListArrayMergeSort(ListArray *array, int head, int length)
+{
+    int middle, i;
+    if (length <= 1) {
+        if (head != LIST_ARRAY_NONE) {
+            array->next[head] = LIST_ARRAY_NONE;
+        }
+        return head;
+    }
+    middle = head;
+    for (i = 0; i < length / 2; i++) {
+        middle = array->next[middle];
+    }
+    //sort the second half first, since sorting the first half cuts it off from middle
+    middle = ListArrayMergeSort(array, middle, length - length / 2);
+    return ListArrayMerge(array, ListArrayMergeSort(array, head, length / 2), middle);
+}
+
+/**
+ * ListArrayInit() prepares an empty list with room for capacity nodes. It grows as needed.
+ *
+ * @param array The list to set up.
+ * @param capacity How many nodes to make room for at first. Must be positive.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL, capacity isn't positive or malloc() fails.
+ */
+int ListArrayInit(ListArray *array, int capacity)
+{
+    if (array == NULL || capacity <= 0) {
+        return STANDARD_ERROR;
+    }
+    array->next = malloc(capacity * sizeof (int));
+    array->previous = malloc(capacity * sizeof (int));
+    array->data = malloc(capacity * sizeof (char *));
+    array->length = malloc(capacity * sizeof (int));
+    array->capacity = capacity;
+    array->used = 0;
+    array->freeSlots = LIST_ARRAY_NONE;
+    array->head = LIST_ARRAY_NONE;
+    array->tail = LIST_ARRAY_NONE;
+    array->size = 0;
+    if (array->next == NULL || array->previous == NULL || array->data == NULL
+            || array->length == NULL) {
+        ListArrayFree(array);
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListArrayCreateAfter() works like LinkedListCreateAfter(): it creates a node holding data and
+ * places it after node.
+ *
+ * @param array An initialized list.
+ * @param node The node that will be before the new one, or LIST_ARRAY_NONE to put the new one first.
+ * @param data The data the new node will hold. Can be NULL.
+ * @return The new node's ID, or LIST_ARRAY_NONE if array is NULL, node isn't in the list or
+ *         malloc() failed.
+ */
+int ListArrayCreateAfter(ListArray *array, int node, char *data)
+{
+    int created;
+    if (array == NULL || (node != LIST_ARRAY_NONE && !ListArrayIsNode(array, node))) {
+        return LIST_ARRAY_NONE;
+    }
+    //reuse a removed node's slot before taking a new one
+    if (array->freeSlots != LIST_ARRAY_NONE) {
+        created = array->freeSlots;
+        array->freeSlots = array->next[created];
+    } else {
+        if (array->used == array->capacity && ListArrayGrow(array) == STANDARD_ERROR) {
+            return LIST_ARRAY_NONE;
+        }
+        created = array->used++;
+    }
+    array->data[created] = data;
+    array->length[created] = ListArrayLengthOf(data);
+    array->previous[created] = node;
+    array->next[created] = (node == LIST_ARRAY_NONE) ? array->head : array->next[node];
+    if (array->next[created] != LIST_ARRAY_NONE) {
+        array->previous[array->next[created]] = created;
+    } else {
+        array->tail = created;
+    }
+    if (node != LIST_ARRAY_NONE) {
+        array->next[node] = created;
+    } else {
+        array->head = created;
+    }
+    array->size++;
+    return created;
+}
+
+/**
+ * ListArrayRemove() works like LinkedListRemove(): it removes a node from the list and returns
+ * its data. The node's ID may be handed out again by a later ListArrayCreateAfter().
+ *
+ * @param array An initialized list.
+ * @param node The node to remove.
+ * @return The node's data, or NULL if array is NULL or node isn't in the list.
+ */
+char *ListArrayRemove(ListArray *array, int node)
+{
+    char *data;
+    if (array == NULL || !ListArrayIsNode(array, node)) {
+        return NULL;
+    }
+    if (array->previous[node] != LIST_ARRAY_NONE) {
+        array->next[array->previous[node]] = array->next[node];
+    } else {
+        array->head = array->next[node];
+    }
+    if (array->next[node] != LIST_ARRAY_NONE) {
+        array->previous[array->next[node]] = array->previous[node];
+    } else {
+        array->tail = array->previous[node];
+    }
+    data = array->data[node];
+    array->data[node] = NULL;
+    array->length[node] = LIST_ARRAY_FREE_LENGTH;
+    array->next[node] = array->freeSlots;
+    array->freeSlots = node;
+    array->size--;
+    return data;
+}
+
+/**
+ * ListArraySize() returns the number of nodes in the list, in constant time.
+ *
+ * @param array An initialized list.
+ * @return The number of nodes, or 0 if array is NULL.
+ */
+int ListArraySize(const ListArray *array)
+{
+    return (array == NULL) ? 0 : array->size;
+}
+
+/**
+ * ListArrayGetFirst() returns the first node in the list.
+ *
+ * @param array An initialized list.
+ * @return The first node's ID, or LIST_ARRAY_NONE if the list is empty or array is NULL.
+ */
+int ListArrayGetFirst(const ListArray *array)
+{
+    return (array == NULL) ? LIST_ARRAY_NONE : array->head;
+}
+
+/**
+ * ListArrayGetLast() returns the last node in the list.
+ *
+ * @param array An initialized list.
+ * @return The last node's ID, or LIST_ARRAY_NONE if the list is empty or array is NULL.
+ */
+int ListArrayGetLast(const ListArray *array)
+{
+    return (array == NULL) ? LIST_ARRAY_NONE : array->tail;
+}
+
+/**
+ * ListArrayGetAt() returns the node at a position in the list, counting from 0 at the head.
+ *
+ * @param array An initialized list.
+ * @param index The position of the node to find.
+ * @return The node's ID, or LIST_ARRAY_NONE if array is NULL or index is out of range.
+ */
+int ListArrayGetAt(const ListArray *array, int index)
+{
+    int node, i;
+    if (array == NULL || index < 0 || index >= array->size) {
+        return LIST_ARRAY_NONE;
+    }
+    //the size is known, so walk in from whichever end is closer
+    if (index < array->size / 2) {
+        for (node = array->head, i = 0; i < index; i++) {
+            node = array->next[node];
+        }
+    } else {
+        for (node = array->tail, i = array->size - 1; i > index; i--) {
+            node = array->previous[node];
+        }
+    }
+    return node;
+}
+
+/**
+ * ListArraySwapData() works like LinkedListSwapData(): it swaps the data of two nodes, lengths and
+ * all.
+ *
+ * @param array An initialized list.
+ * @param first A node.
+ * @param second Another node.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL or either node isn't in the list.
+ */
+int ListArraySwapData(ListArray *array, int first, int second)
+{
+    char *data;
+    int length;
+    if (array == NULL || !ListArrayIsNode(array, first) || !ListArrayIsNode(array, second)) {
+        return STANDARD_ERROR;
+    }
+    data = array->data[first];
+    array->data[first] = array->data[second];
+    array->data[second] = data;
+    length = array->length[first];
+    array->length[first] = array->length[second];
+    array->length[second] = length;
+    return SUCCESS;
+}
+
+/**
+ * ListArraySetData() replaces a node's data and updates its cached length.
+ *
+ * @param array An initialized list.
+ * @param node The node to change.
+ * @param data The new data. Can be NULL.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL or node isn't in the list.
+ */
+int ListArraySetData(ListArray *array, int node, char *data)
+{
+    if (array == NULL || !ListArrayIsNode(array, node)) {
+        return STANDARD_ERROR;
+    }
+    array->data[node] = data;
+    array->length[node] = ListArrayLengthOf(data);
+    return SUCCESS;
+}
+
+/**
+ * ListArraySort() sorts the list into the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically). Like LinkedListSortNatural(), it is stable and relinks the nodes
+ * instead of moving their data, so every node keeps its data. Lengths are compared from length[],
+ * so strings are only read to break ties.
+ *
+ * @param array An initialized list.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL.
+ */
+int ListArraySort(ListArray *array)
+{
+    int node, previous = LIST_ARRAY_NONE;
+    if (array == NULL) {
+        return STANDARD_ERROR;
+    }
+    array->head = ListArrayMergeSort(array, array->head, array->size);
+    //the merges only link forwards, so rebuild the backward links
+    for (node = array->head; node != LIST_ARRAY_NONE; node = array->next[node]) {
+        array->previous[node] = previous;
+        previous = node;
+    }
+    array->tail = previous;
+    return SUCCESS;
+}
+
+/**
+ * ListArrayIsSorted() checks whether the list is in LinkedListSort() order.
+ *
+ * @param array An initialized list.
+ * @return TRUE if it is sorted (an empty list is), FALSE if it isn't or array is NULL.
+ */
+int ListArrayIsSorted(const ListArray *array)
+{
+    int node;
+    if (array == NULL) {
+        return FALSE;
+    }
+    for (node = array->head; node != LIST_ARRAY_NONE && array->next[node] != LIST_ARRAY_NONE;
+            node = array->next[node]) {
+        if (ListArrayCompareNodes(array, node, array->next[node]) > 0) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * ListArrayCountNull() counts the nodes whose data is NULL, in one pass over length[].
+ *
+ * @param array An initialized list.
+ * @return The number of NULL nodes, or 0 if array is NULL.
+ */
+int ListArrayCountNull(const ListArray *array)
+{
+    const int *length;
+    int i, count = 0;
+    if (array == NULL) {
+        return 0;
+    }
+    //order doesn't matter here, so free slots are simply skipped by their length code and the
+    //loop has no branches or links to follow
+    length = array->length;
+    for (i = 0; i < array->used; i++) {
+        count += (length[i] == LIST_ARRAY_NULL_LENGTH);
+    }
+    return count;
+}
+
+/**
+ * ListArrayTotalLength() adds up the lengths of every node's data, in one pass over length[].
+ * NULLs count as 0.
+ *
+ * @param array An initialized list.
+ * @return The total length, or 0 if array is NULL.
+ */
+unsigned long ListArrayTotalLength(const ListArray *array)
+{
+    const int *length;
+    unsigned long total = 0;
+    int i;
+    if (array == NULL) {
+        return 0;
+    }
+    length = array->length;
+    for (i = 0; i < array->used; i++) {
+        total += (length[i] > 0) ? length[i] : 0;
+    }
+    return total;
+}
+
+/**
+ * ListArrayPrint() works like LinkedListPrint(): it prints the list's data in order, in square
+ * brackets and separated by spaces.
+ *
+ * @param array An initialized list.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL.
+ */
+int ListArrayPrint(const ListArray *array)
+{
+    int node;
+    if (array == NULL) {
+        return STANDARD_ERROR;
+    }
+    printf("[");
+    for (node = array->head; node != LIST_ARRAY_NONE; node = array->next[node]) {
+        printf(array->next[node] != LIST_ARRAY_NONE ? "%s " : "%s", array->data[node]);
+    }
+    printf("]\n");
+    return SUCCESS;
+}
+
+/**
+ * ListArrayFromList() appends the data of every item in a regular list, in order.
+ *
+ * @param array An initialized list.
+ * @param list Any element in the regular list.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or malloc() fails.
+ */
+int ListArrayFromList(ListArray *array, ListItem *list)
+{
+    ListCursor cursor;
+    ListItem *item;
+    int node;
+    if (array == NULL || list == NULL) {
+        return STANDARD_ERROR;
+    }
+    node = array->tail;
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        node = ListArrayCreateAfter(array, node, item->data);
+        if (node == LIST_ARRAY_NONE) {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListArrayToList() builds a regular list with the same data in the same order.
+ *
+ * @param array An initialized list.
+ * @return The head of the new list, or NULL if the list is empty or malloc() fails.
+ */
+ListItem *ListArrayToList(const ListArray *array)
+{
+    ListItem *head = NULL, *tail = NULL;
+    int node;
+    if (array == NULL) {
+        return NULL;
+    }
+    for (node = array->head; node != LIST_ARRAY_NONE; node = array->next[node]) {
+        tail = LinkedListCreateAfter(tail, array->data[node]);
+        if (tail == NULL) {
+            //give back what was built so far
+            while (head != NULL) {
+                tail = head->nextItem;
+                LinkedListRemove(head);
+                head = tail;
+            }
+            return NULL;
+        }
+        if (head == NULL) {
+            head = tail;
+        }
+    }
+    return head;
+}
+
+/**
+ * ListArrayFree() frees the arrays. The data itself is left alone. The list must be initialized
+ * again before it is reused.
+ *
+ * @param array The list to free.
+ */
+void ListArrayFree(ListArray *array)
+{
+    if (array == NULL) {
+        return;
+    }
+    free(array->next);
+    free(array->previous);
+    free(array->data);
+    free(array->length);
+    memset(array, 0, sizeof (ListArray));
+    array->head = LIST_ARRAY_NONE;
+    array->tail = LIST_ARRAY_NONE;
+    array->freeSlots = LIST_ARRAY_NONE;
+}
@@ -0,0 +1,205 @@
+#ifndef LISTARRAY_H
+#define LISTARRAY_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * A struct-of-arrays backend for a list of strings. Instead of one ListItem per node, the list
+ * keeps each field in an array of its own, indexed by node ID: next[], previous[] and data[], plus
+ * the cached strlen() of every node's data in length[]. The logical order is still given by the
+ * next/previous links, so inserting and removing cost O(1) as usual, but scans that don't care
+ * about the order (counting NULLs, adding up lengths) run straight down a contiguous array, which
+ * the compiler can vectorize on the host. Scans that do follow the order, like sorting or checking
+ * sortedness, compare the cached lengths first and only read the strings on a tie.
+ *
+ * A ListArray is the whole list rather than a chain of links, so every function takes the array
+ * plus node IDs where LinkedList.h takes ListItems. LIST_ARRAY_NONE plays the part of NULL. Node
+ * IDs stay valid until their node is removed, after which they can be reused. Use
+ * ListArrayFromList() and ListArrayToList() to move between the two representations when an
+ * operation is only available on regular lists.
+ *
+ * The cached lengths are taken when data is stored, so the strings must not change length while
+ * they are in the list.
+ */
+
+// The "no node" ID, like a NULL ListItem pointer.
+#define LIST_ARRAY_NONE (-1)
+
+// Codes in length[] that aren't real lengths.
+#define LIST_ARRAY_NULL_LENGTH (-1) //the node's data is NULL
+#define LIST_ARRAY_FREE_LENGTH (-2) //the slot isn't in use
+
+/**
+ * A list of strings stored as parallel arrays. Set it up with ListArrayInit(). Free slots are
+ * chained through next[].
+ */
+typedef struct ListArray {
+    int *next;
+    int *previous;
+    char **data;
+    int *length; //strlen() of data, or one of the LIST_ARRAY_*_LENGTH codes
+    int capacity; //size of each array
+    int used; //slots from 0 to used - 1 have been handed out at some point
+    int freeSlots; //first free slot below used, or LIST_ARRAY_NONE
+    int head;
+    int tail;
+    int size;
+} ListArray;
+
+/**
+ * ListArrayInit() prepares an empty list with room for capacity nodes. It grows as needed.
+ *
+ * @param array The list to set up.
+ * @param capacity How many nodes to make room for at first. Must be positive.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL, capacity isn't positive or malloc() fails.
+ */
+int ListArrayInit(ListArray *array, int capacity);
+
+/**
+ * ListArrayCreateAfter() works like LinkedListCreateAfter(): it creates a node holding data and
+ * places it after node.
+ *
+ * @param array An initialized list.
+ * @param node The node that will be before the new one, or LIST_ARRAY_NONE to put the new one first.
+ * @param data The data the new node will hold. Can be NULL.
+ * @return The new node's ID, or LIST_ARRAY_NONE if array is NULL, node isn't in the list or
+ *         malloc() failed.
+ */
+int ListArrayCreateAfter(ListArray *array, int node, char *data);
+
+/**
+ * ListArrayRemove() works like LinkedListRemove(): it removes a node from the list and returns
+ * its data. The node's ID may be handed out again by a later ListArrayCreateAfter().
+ *
+ * @param array An initialized list.
+ * @param node The node to remove.
+ * @return The node's data, or NULL if array is NULL or node isn't in the list.
+ */
+char *ListArrayRemove(ListArray *array, int node);
+
+/**
+ * ListArraySize() returns the number of nodes in the list, in constant time.
+ *
+ * @param array An initialized list.
+ * @return The number of nodes, or 0 if array is NULL.
+ */
+int ListArraySize(const ListArray *array);
+
+/**
+ * ListArrayGetFirst() returns the first node in the list.
+ *
+ * @param array An initialized list.
+ * @return The first node's ID, or LIST_ARRAY_NONE if the list is empty or array is NULL.
+ */
+int ListArrayGetFirst(const ListArray *array);
+
+/**
+ * ListArrayGetLast() returns the last node in the list.
+ *
+ * @param array An initialized list.
+ * @return The last node's ID, or LIST_ARRAY_NONE if the list is empty or array is NULL.
+ */
+int ListArrayGetLast(const ListArray *array);
+
+/**
+ * ListArrayGetAt() returns the node at a position in the list, counting from 0 at the head.
+ *
+ * @param array An initialized list.
+ * @param index The position of the node to find.
+ * @return The node's ID, or LIST_ARRAY_NONE if array is NULL or index is out of range.
+ */
+int ListArrayGetAt(const ListArray *array, int index);
+
+/**
+ * ListArraySwapData() works like LinkedListSwapData(): it swaps the data of two nodes, lengths and
+ * all.
+ *
+ * @param array An initialized list.
+ * @param first A node.
+ * @param second Another node.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL or either node isn't in the list.
+ */
+int ListArraySwapData(ListArray *array, int first, int second);
+
+/**
+ * ListArraySetData() replaces a node's data and updates its cached length.
+ *
+ * @param array An initialized list.
+ * @param node The node to change.
+ * @param data The new data. Can be NULL.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL or node isn't in the list.
+ */
+int ListArraySetData(ListArray *array, int node, char *data);
+
+/**
+ * ListArraySort() sorts the list into the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically). Like LinkedListSortNatural(), it is stable and relinks the nodes
+ * instead of moving their data, so every node keeps its data. Lengths are compared from length[],
+ * so strings are only read to break ties.
+ *
+ * @param array An initialized list.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL.
+ */
+int ListArraySort(ListArray *array);
+
+/**
+ * ListArrayIsSorted() checks whether the list is in LinkedListSort() order.
+ *
+ * @param array An initialized list.
+ * @return TRUE if it is sorted (an empty list is), FALSE if it isn't or array is NULL.
+ */
+int ListArrayIsSorted(const ListArray *array);
+
+/**
+ * ListArrayCountNull() counts the nodes whose data is NULL, in one pass over length[].
+ *
+ * @param array An initialized list.
+ * @return The number of NULL nodes, or 0 if array is NULL.
+ */
+int ListArrayCountNull(const ListArray *array);
+
+/**
+ * ListArrayTotalLength() adds up the lengths of every node's data, in one pass over length[].
+ * NULLs count as 0.
+ *
+ * @param array An initialized list.
+ * @return The total length, or 0 if array is NULL.
+ */
+unsigned long ListArrayTotalLength(const ListArray *array);
+
+/**
+ * ListArrayPrint() works like LinkedListPrint(): it prints the list's data in order, in square
+ * brackets and separated by spaces.
+ *
+ * @param array An initialized list.
+ * @return SUCCESS or STANDARD_ERROR if array is NULL.
+ */
+int ListArrayPrint(const ListArray *array);
+
+/**
+ * ListArrayFromList() appends the data of every item in a regular list, in order.
+ *
+ * @param array An initialized list.
+ * @param list Any element in the regular list.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or malloc() fails.
+ */
+int ListArrayFromList(ListArray *array, ListItem *list);
+
+/**
+ * ListArrayToList() builds a regular list with the same data in the same order.
+ *
+ * @param array An initialized list.
+ * @return The head of the new list, or NULL if the list is empty or malloc() fails.
+ */
+ListItem *ListArrayToList(const ListArray *array);
+
+/**
+ * ListArrayFree() frees the arrays. The data itself is left alone. The list must be initialized
+ * again before it is reused.
+ *
+ * @param array The list to free.
+ */
+void ListArrayFree(ListArray *array);
+
+#endif
@@ -0,0 +1,411 @@
+/*
+ * File:   ListExternalSort.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ListExternalSort.h"
+#include "BOARD.h"
+
+/*
+ * One run being merged: its file and the word at the front of it.
+ */
+typedef struct RunReader {
+    FILE *file;
+    int run; //position among the runs being merged, breaks ties so the merge stays stable
+    char *word; //NULL if the front record is NULL
+    char *buffer;
+    size_t capacity;
+} RunReader;
+
+/*
+ * Creates an anonymous temporary file in the sort's directory. The name is unlinked straight away
+ * so the file goes away by itself once it's closed.
+ */
+static FILE *ListExternalSortTempFile(const ListExternalSort *sorter)
+{
+    const char *directory = (sorter->tempDirectory != NULL) ? sorter->tempDirectory : "/tmp";
+    size_t length = strlen(directory);
+    char *path = malloc(length + sizeof ("/listsortXXXXXX"));
+    FILE *file = NULL;
+    int descriptor;
+    if (path == NULL) {
+        return NULL;
+    }
+    memcpy(path, directory, length);
+    strcpy(path + length, "/listsortXXXXXX");
+    descriptor = mkstemp(path);
+    if (descriptor >= 0) {
+        unlink(path);
+        file = fdopen(descriptor, "w+b");
+        if (file == NULL) {
+            close(descriptor);
+        }
+    }
+    free(path);
+    return file;
+}
+
+/*
+ * Writes one record: the word's length plus one as a LEB128 varint (0 for NULL) followed by the
+ * word's characters. Has the shape of a ListExternalSortCallback so a merge can write to a file.
+ */
+static int ListExternalSortWriteRecord(char *word, void *context)
+{
+    FILE *file = context;
+    unsigned long value = (word != NULL) ? strlen(word) + 1 : 0;
+    do {
+        unsigned char byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        if (putc(byte, file) == EOF) {
+            return STANDARD_ERROR;
+        }
+    } while (value != 0);
+    if (word != NULL && fwrite(word, 1, strlen(word), file) != strlen(word)) {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/*
+ * Reads the next record of a run into reader->word. Returns SUCCESS, SIZE_ERROR at the end of the
+ * run or STANDARD_ERROR if the run is damaged or the buffer couldn't grow.
+ */
+static int ListExternalSortReadRecord(RunReader *reader)
+{
+    unsigned long value = 0;
+    int shift = 0, byte;
+    do {
+        byte = getc(reader->file);
+        if (byte == EOF) {
+            return (shift == 0) ? SIZE_ERROR : STANDARD_ERROR;
+        }
+        value |= (unsigned long) (byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    if (value == 0) {
+        reader->word = NULL;
+        return SUCCESS;
+    }
+    if (value > reader->capacity) {
+        char *bigger = realloc(reader->buffer, value);
+        if (bigger == NULL) {
+            return STANDARD_ERROR;
+        }
+        reader->buffer = bigger;
+        reader->capacity = value;
+    }
+    if (fread(reader->buffer, 1, value - 1, reader->file) != value - 1) {
+        return STANDARD_ERROR;
+    }
+    reader->buffer[value - 1] = '\0';
+    reader->word = reader->buffer;
+    return SUCCESS;
+}
+
+/*
+ * Whether reader a's word has to come out before reader b's.
+ */
+static int ListExternalSortBefore(const RunReader *a, const RunReader *b)
+{
+    int order = LinkedListCompare(a->word, b->word);
+    return order < 0 || (order == 0 && a->run < b->run);
+}
+
+/*
+ * Moves heap[index] down until neither of its children comes before it.
+ */
+static void ListExternalSortSiftDown(RunReader **heap, int count, int index)
+{
+    while (1) {
+        int child = 2 * index + 1;
+        RunReader *swap;
+        if (child >= count) {
+            return;
+        }
+        if (child + 1 < count && ListExternalSortBefore(heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!ListExternalSortBefore(heap[child], heap[index])) {
+            return;
+        }
+        swap = heap[index];
+        heap[index] = heap[child];
+        heap[child] = swap;
+        index = child;
+    }
+}
+
+/*
+ * Merges count runs, oldest first, passing every word to callback in order. The runs are read from
+ * the start and left at their end.
+ */
+static int ListExternalSortMerge(FILE **runs, int count, ListExternalSortCallback callback,
+        void *context)
+{
+    RunReader *readers = calloc(count, sizeof (RunReader));
+    RunReader **heap = malloc(count * sizeof (RunReader *));
+    int size = 0, status = SUCCESS, i;
+    if (readers == NULL || heap == NULL) {
+        free(readers);
+        free(heap);
+        return STANDARD_ERROR;
+    }
+    for (i = 0; i < count && status == SUCCESS; i++) {
+        readers[i].file = runs[i];
+        readers[i].run = i;
+        rewind(runs[i]);
+        status = ListExternalSortReadRecord(&readers[i]);
+        if (status == SUCCESS) {
+            heap[size++] = &readers[i];
+        } else if (status == SIZE_ERROR) {
+            status = SUCCESS;
+        }
+    }
+    for (i = size / 2 - 1; i >= 0; i--) {
+        ListExternalSortSiftDown(heap, size, i);
+    }
+
+    while (size > 0 && status == SUCCESS) {
+        status = callback(heap[0]->word, context);
+        if (status == SUCCESS) {
+            status = ListExternalSortReadRecord(heap[0]);
+            if (status == SIZE_ERROR) {
+                //this run is used up
+                heap[0] = heap[--size];
+                status = SUCCESS;
+            }
+            ListExternalSortSiftDown(heap, size, 0);
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        free(readers[i].buffer);
+    }
+    free(readers);
+    free(heap);
+    return status;
+}
+
+/*
+ * Empties the in-memory run. Its ListItems and words all live in sorter->pool, so there is nothing
+ * to free one by one.
+ */
+static void ListExternalSortClearRun(ListExternalSort *sorter)
+{
+    sorter->tail = NULL;
+    sorter->itemCount = 0;
+    sorter->stringsUsed = 0;
+}
+
+/*
+ * Remembers a spilled run, growing the array of runs if needed.
+ */
+static int ListExternalSortPushRun(ListExternalSort *sorter, FILE *run)
+{
+    if (sorter->runCount == sorter->runCapacity) {
+        int capacity = (sorter->runCapacity > 0) ? 2 * sorter->runCapacity : 8;
+        FILE **bigger = realloc(sorter->runs, capacity * sizeof (FILE *));
+        if (bigger == NULL) {
+            return STANDARD_ERROR;
+        }
+        sorter->runs = bigger;
+        sorter->runCapacity = capacity;
+    }
+    sorter->runs[sorter->runCount++] = run;
+    return SUCCESS;
+}
+
+/*
+ * Sorts the in-memory run, writes it to a new run file and empties it.
+ */
+static int ListExternalSortSpill(ListExternalSort *sorter)
+{
+    ListItem *item;
+    FILE *run;
+    if (sorter->tail == NULL) {
+        return SUCCESS;
+    }
+    run = ListExternalSortTempFile(sorter);
+    if (run == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListSortNatural(sorter->tail);
+    for (item = LinkedListGetFirst(sorter->tail); item != NULL; item = item->nextItem) {
+        if (ListExternalSortWriteRecord(item->data, run) != SUCCESS) {
+            fclose(run);
+            return STANDARD_ERROR;
+        }
+    }
+    if (fflush(run) != 0 || ListExternalSortPushRun(sorter, run) != SUCCESS) {
+        fclose(run);
+        return STANDARD_ERROR;
+    }
+    ListExternalSortClearRun(sorter);
+    return SUCCESS;
+}
+
+/**
+ * ListExternalSortInit() prepares an empty sort.
+ *
+ * @param sorter The sort to set up.
+ * @param memoryBudget How many bytes one in-memory run may use, including its ListItems.
+ * @param tempDirectory Where to put the run files, or NULL for /tmp. They are deleted as soon as
+ *                      they are created, so nothing is left behind even after a crash.
+ * @return SUCCESS, or STANDARD_ERROR if passed a NULL pointer, a tiny budget or malloc() fails.
+ */
+int ListExternalSortInit(ListExternalSort *sorter, unsigned long memoryBudget,
+        const char *tempDirectory)
+{
+    if (sorter == NULL || memoryBudget < sizeof (ListItem) + 2) {
+        return STANDARD_ERROR;
+    }
+    memset(sorter, 0, sizeof (ListExternalSort));
+    sorter->memoryBudget = memoryBudget;
+    sorter->tempDirectory = tempDirectory;
+    sorter->pool = malloc(memoryBudget);
+    if (sorter->pool == NULL) {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListExternalSortAdd() copies one word into the sort, spilling the current run first if the word
+ * doesn't fit in it.
+ *
+ * @param sorter An initialized sort.
+ * @param word The word to add. Can be NULL.
+ * @return SUCCESS, or STANDARD_ERROR if the word is bigger than the whole budget or a run couldn't
+ *         be allocated or written.
+ */
+int ListExternalSortAdd(ListExternalSort *sorter, const char *word)
+{
+    unsigned long length = (word != NULL) ? strlen(word) + 1 : 0;
+    char *copy = NULL;
+    ListItem *item;
+    if (sorter == NULL || sorter->pool == NULL
+            || sizeof (ListItem) + length > sorter->memoryBudget) {
+        return STANDARD_ERROR;
+    }
+    if ((sorter->itemCount + 1) * sizeof (ListItem) + sorter->stringsUsed + length >
+            sorter->memoryBudget && ListExternalSortSpill(sorter) != SUCCESS) {
+        return STANDARD_ERROR;
+    }
+    //items are taken from the front of the pool and words from the back, so neither needs its own
+    //allocation and the two meet somewhere in the middle
+    item = (ListItem *) sorter->pool + sorter->itemCount;
+    if (word != NULL) {
+        copy = sorter->pool + sorter->memoryBudget - sorter->stringsUsed - length;
+        memcpy(copy, word, length);
+    }
+    LinkedListSetData(item, copy);
+    item->previousItem = sorter->tail;
+    item->nextItem = NULL;
+    if (sorter->tail != NULL) {
+        sorter->tail->nextItem = item;
+    }
+    sorter->tail = item;
+    sorter->itemCount++;
+    sorter->stringsUsed += length;
+    return SUCCESS;
+}
+
+/**
+ * ListExternalSortFinish() merges everything added so far and calls callback with each word in
+ * order. If nothing was ever spilled, the words are sorted and streamed straight from memory.
+ * The sort is empty afterwards and can be reused.
+ *
+ * @param sorter An initialized sort.
+ * @param callback Called once per word, in order.
+ * @param context Passed through to callback untouched.
+ * @return SUCCESS, or STANDARD_ERROR if a run couldn't be read or written or callback failed.
+ */
+int ListExternalSortFinish(ListExternalSort *sorter, ListExternalSortCallback callback,
+        void *context)
+{
+    int status = SUCCESS, i;
+    if (sorter == NULL || sorter->pool == NULL || callback == NULL) {
+        return STANDARD_ERROR;
+    }
+
+    if (sorter->runCount == 0) {
+        //everything fit in memory, so there's nothing to merge
+        ListItem *item;
+        if (sorter->tail != NULL) {
+            LinkedListSortNatural(sorter->tail);
+            for (item = LinkedListGetFirst(sorter->tail); item != NULL && status == SUCCESS;
+                    item = item->nextItem) {
+                status = callback(item->data, context);
+            }
+        }
+        ListExternalSortClearRun(sorter);
+        return status;
+    }
+
+    status = ListExternalSortSpill(sorter);
+    //merge the oldest runs together until one pass is enough. The merged run takes their place at
+    //the front so equal words keep coming out oldest first
+    while (status == SUCCESS && sorter->runCount > LIST_EXTERNAL_SORT_FAN_IN) {
+        FILE *merged = ListExternalSortTempFile(sorter);
+        if (merged == NULL) {
+            status = STANDARD_ERROR;
+            break;
+        }
+        status = ListExternalSortMerge(sorter->runs, LIST_EXTERNAL_SORT_FAN_IN,
+                ListExternalSortWriteRecord, merged);
+        if (status == SUCCESS && fflush(merged) != 0) {
+            status = STANDARD_ERROR;
+        }
+        if (status != SUCCESS) {
+            fclose(merged);
+            break;
+        }
+        for (i = 0; i < LIST_EXTERNAL_SORT_FAN_IN; i++) {
+            fclose(sorter->runs[i]);
+        }
+        sorter->runs[0] = merged;
+        memmove(&sorter->runs[1], &sorter->runs[LIST_EXTERNAL_SORT_FAN_IN],
+                (sorter->runCount - LIST_EXTERNAL_SORT_FAN_IN) * sizeof (FILE *));
+        sorter->runCount -= LIST_EXTERNAL_SORT_FAN_IN - 1;
+    }
+    if (status == SUCCESS) {
+        status = ListExternalSortMerge(sorter->runs, sorter->runCount, callback, context);
+    }
+
+    ListExternalSortClearRun(sorter);
+    for (i = 0; i < sorter->runCount; i++) {
+        fclose(sorter->runs[i]);
+    }
+    sorter->runCount = 0;
+    return status;
+}
+
+/**
+ * ListExternalSortFree() releases everything the sort holds, including any run files.
+ *
+ * @param sorter The sort to free.
+ */
+void ListExternalSortFree(ListExternalSort *sorter)
+{
+    int i;
+    if (sorter == NULL) {
+        return;
+    }
+    ListExternalSortClearRun(sorter);
+    for (i = 0; i < sorter->runCount; i++) {
+        fclose(sorter->runs[i]);
+    }
+    free(sorter->runs);
+    free(sorter->pool);
+    memset(sorter, 0, sizeof (ListExternalSort));
+}
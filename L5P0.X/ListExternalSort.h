@@ -0,0 +1,101 @@
+#ifndef LISTEXTERNALSORT_H
+#define LISTEXTERNALSORT_H
+
+#include <stdio.h>
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * An external merge sort for word sets too big to hold in memory as a list, putting them in
+ * LinkedListSort() order (NULL, then by length, then alphabetically). This is host-only, as it
+ * needs temporary files, and is left out of the board build.
+ *
+ * Words are fed in one at a time with ListExternalSortAdd(). They are copied into an in-memory run
+ * until the run reaches the memory budget. The run's ListItems and words share a single allocation
+ * of exactly that many bytes, so a run never uses more. Once it is full, the run is sorted with
+ * LinkedListSortNatural() and spilled to a temporary file as length-prefixed records. When
+ * ListExternalSortFinish() is called, the runs are merged back k ways at a time (in several passes
+ * if there are more than LIST_EXTERNAL_SORT_FAN_IN of them) and the words are streamed out in
+ * order. Equal words come out in the order they went in.
+ *
+ * Usage:
+ * ListExternalSort sorter;
+ * ListExternalSortInit(&sorter, 64 * 1024 * 1024, "/var/tmp");
+ * while (...) {
+ *     ListExternalSortAdd(&sorter, word);
+ * }
+ * ListExternalSortFinish(&sorter, PrintWord, NULL);
+ * ListExternalSortFree(&sorter);
+ */
+
+// How many runs are merged at once. More runs than this are merged over several passes.
+#ifndef LIST_EXTERNAL_SORT_FAN_IN
+#define LIST_EXTERNAL_SORT_FAN_IN 64
+#endif
+
+/**
+ * Called with every word, in sorted order, by ListExternalSortFinish(). word is only valid during
+ * the call, so copy it if it needs to be kept. Returning STANDARD_ERROR stops the merge.
+ */
+typedef int (*ListExternalSortCallback)(char *word, void *context);
+
+/**
+ * The state of one external sort. Set it up with ListExternalSortInit().
+ */
+typedef struct ListExternalSort {
+    unsigned long memoryBudget; //bytes of strings and ListItems one run may hold
+    const char *tempDirectory;
+    ListItem *tail; //the run being filled
+    char *pool; //memoryBudget bytes: the run's ListItems from the front, its words from the back
+    unsigned long itemCount;
+    unsigned long stringsUsed;
+    FILE **runs; //spilled runs, oldest first
+    int runCount;
+    int runCapacity;
+} ListExternalSort;
+
+/**
+ * ListExternalSortInit() prepares an empty sort.
+ *
+ * @param sorter The sort to set up.
+ * @param memoryBudget How many bytes one in-memory run may use, including its ListItems.
+ * @param tempDirectory Where to put the run files, or NULL for /tmp. They are deleted as soon as
+ *                      they are created, so nothing is left behind even after a crash.
+ * @return SUCCESS, or STANDARD_ERROR if passed a NULL pointer, a tiny budget or malloc() fails.
+ */
+int ListExternalSortInit(ListExternalSort *sorter, unsigned long memoryBudget,
+        const char *tempDirectory);
+
+/**
+ * ListExternalSortAdd() copies one word into the sort, spilling the current run first if the word
+ * doesn't fit in it.
+ *
+ * @param sorter An initialized sort.
+ * @param word The word to add. Can be NULL.
+ * @return SUCCESS, or STANDARD_ERROR if the word is bigger than the whole budget or a run couldn't
+ *         be allocated or written.
+ */
+int ListExternalSortAdd(ListExternalSort *sorter, const char *word);
+
+/**
+ * ListExternalSortFinish() merges everything added so far and calls callback with each word in
+ * order. If nothing was ever spilled, the words are sorted and streamed straight from memory.
+ * The sort is empty afterwards and can be reused.
+ *
+ * @param sorter An initialized sort.
+ * @param callback Called once per word, in order.
+ * @param context Passed through to callback untouched.
+ * @return SUCCESS, or STANDARD_ERROR if a run couldn't be read or written or callback failed.
+ */
+int ListExternalSortFinish(ListExternalSort *sorter, ListExternalSortCallback callback,
+        void *context);
+
+/**
+ * ListExternalSortFree() releases everything the sort holds, including any run files.
+ *
+ * @param sorter The sort to free.
+ */
+void ListExternalSortFree(ListExternalSort *sorter);
+
+#endif
@@ -0,0 +1,304 @@
+/*
+ * File:   ListMultiset.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ListMultiset.h"
+#include "BOARD.h"
+
+//how many items a new multiset has room for before items has to grow
+#define LIST_MULTISET_INITIAL_CAPACITY 16
+
+/*
+ * Doubles the room in items.
+ */
+static int ListMultisetGrow(ListMultiset *set)
+{
+    ListMultisetItem **items = realloc(set->items, 2 * set->capacity * sizeof (ListMultisetItem *));
+    if (items == NULL) {
+        return STANDARD_ERROR;
+    }
+    set->items = items;
+    set->capacity *= 2;
+    return SUCCESS;
+}
+
+/*
+ * Stably merges two sorted chains linked through nextItem only.
+ */
+static ListMultisetItem *ListMultisetMerge(ListMultisetItem *first, ListMultisetItem *second)
+{
+    ListMultisetItem head;
+    ListMultisetItem *tail = &head;
+    while (first != NULL && second != NULL) {
+        //ties go to the first chain, which keeps the merge stable
+        if (LinkedListCompare(first->data, second->data) <= 0) {
+            tail->nextItem = first;
+            first = first->nextItem;
+        } else {
+            tail->nextItem = second;
+            second = second->nextItem;
+        }
+        tail = tail->nextItem;
+    }
+    tail->nextItem = (first != NULL) ? first : second;
+    return head.nextItem;
+}
+
+/*
+ * Merge sorts the first length items of the chain starting at head, linked through nextItem only.
+ */
+static ListMultisetItem *ListMultisetMergeSort(ListMultisetItem *head, int length)
+{
+    ListMultisetItem *middle;
+    int i;
+    if (length <= 1) {
+        if (head != NULL) {
+            head->nextItem = NULL;
+        }
+        return head;
+    }
+    middle = head;
+    for (i = 0; i < length / 2; i++) {
+        middle = middle->nextItem;
+    }
+    //sort the second half first, since sorting the first half cuts it off from middle
+    middle = ListMultisetMergeSort(middle, length - length / 2);
+    return ListMultisetMerge(ListMultisetMergeSort(head, length / 2), middle);
+}
+
+/**
+ * ListMultisetInit() prepares an empty multiset.
+ *
+ * @param set The multiset to set up.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL or malloc() fails.
+ */
+int ListMultisetInit(ListMultiset *set)
+{
+    if (set == NULL) {
+        return STANDARD_ERROR;
+    }
+    memset(set, 0, sizeof (ListMultiset));
+    set->items = malloc(LIST_MULTISET_INITIAL_CAPACITY * sizeof (ListMultisetItem *));
+    if (set->items == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (WordTableInit(&set->index) == STANDARD_ERROR) {
+        free(set->items);
+        set->items = NULL;
+        return STANDARD_ERROR;
+    }
+    set->capacity = LIST_MULTISET_INITIAL_CAPACITY;
+    return SUCCESS;
+}
+
+/**
+ * ListMultisetAdd() adds count occurrences of word. If the word is already in the multiset its
+ * count goes up; otherwise a new item is appended at the tail.
+ *
+ * @param set An initialized multiset.
+ * @param word The word to add. Can be NULL.
+ * @param count How many occurrences to add. Must be positive.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL, count isn't positive or malloc() fails.
+ */
+int ListMultisetAdd(ListMultiset *set, char *word, int count)
+{
+    ListMultisetItem *item;
+    if (set == NULL || set->items == NULL || count <= 0) {
+        return STANDARD_ERROR;
+    }
+    item = ListMultisetFind(set, word);
+
+    if (item == NULL) {
+        if (set->distinct == set->capacity && ListMultisetGrow(set) == STANDARD_ERROR) {
+            return STANDARD_ERROR;
+        }
+        item = malloc(sizeof (ListMultisetItem));
+        if (item == NULL) {
+            return STANDARD_ERROR;
+        }
+        //the index maps the word to where its item goes in items
+        if (word != NULL && WordTableAdd(&set->index, word, set->distinct) == STANDARD_ERROR) {
+            free(item);
+            return STANDARD_ERROR;
+        }
+        item->data = word;
+        item->count = 0;
+        item->nextItem = NULL;
+        item->previousItem = set->tail;
+        if (set->tail != NULL) {
+            set->tail->nextItem = item;
+        } else {
+            set->head = item;
+        }
+        set->tail = item;
+        set->items[set->distinct++] = item;
+        if (word == NULL) {
+            set->nullItem = item;
+        }
+    }
+    item->count += count;
+    set->total += count;
+    return SUCCESS;
+}
+
+/**
+ * ListMultisetFind() looks up the item holding a word, comparing by contents.
+ *
+ * @param set An initialized multiset.
+ * @param word The word to find. Can be NULL.
+ * @return The word's item, or NULL if it isn't in the multiset.
+ */
+ListMultisetItem *ListMultisetFind(const ListMultiset *set, const char *word)
+{
+    WordCountPair *entry;
+    if (set == NULL || set->items == NULL) {
+        return NULL;
+    }
+    if (word == NULL) {
+        return set->nullItem;
+    }
+    entry = WordTableLookup(&set->index, word);
+    return (entry != NULL) ? set->items[entry->count] : NULL;
+}
+
+/**
+ * ListMultisetFromList() adds every item of a regular list to a multiset.
+ *
+ * @param set An initialized multiset.
+ * @param list Any element in the list to add.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or malloc() fails.
+ */
+int ListMultisetFromList(ListMultiset *set, ListItem *list)
+{
+    ListCursor cursor;
+    ListItem *item;
+    if (set == NULL || list == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        if (ListMultisetAdd(set, item->data, 1) == STANDARD_ERROR) {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListMultisetToList() builds a regular list with every occurrence in the multiset, in the
+ * multiset's order, each word repeated count times.
+ *
+ * @param set An initialized multiset.
+ * @return The head of the new list, or NULL if the multiset is empty or malloc() fails.
+ */
+ListItem *ListMultisetToList(const ListMultiset *set)
+{
+    ListMultisetItem *item;
+    ListItem *head = NULL, *tail = NULL;
+    int i;
+    if (set == NULL) {
+        return NULL;
+    }
+    for (item = set->head; item != NULL; item = item->nextItem) {
+        for (i = 0; i < item->count; i++) {
+            tail = LinkedListCreateAfter(tail, item->data);
+            if (tail == NULL) {
+                //give back what was built so far
+                while (head != NULL) {
+                    tail = head->nextItem;
+                    LinkedListRemove(head);
+                    head = tail;
+                }
+                return NULL;
+            }
+            if (head == NULL) {
+                head = tail;
+            }
+        }
+    }
+    return head;
+}
+
+/**
+ * ListMultisetSort() puts the items in the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically). Only the distinct words are sorted, so this costs
+ * O(d log d) for d distinct words however many occurrences there are.
+ *
+ * @param set An initialized multiset.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL.
+ */
+int ListMultisetSort(ListMultiset *set)
+{
+    ListMultisetItem *item, *previous = NULL;
+    if (set == NULL) {
+        return STANDARD_ERROR;
+    }
+    set->head = ListMultisetMergeSort(set->head, set->distinct);
+    //the merges only link forwards, so rebuild the backward links
+    for (item = set->head; item != NULL; item = item->nextItem) {
+        item->previousItem = previous;
+        previous = item;
+    }
+    set->tail = previous;
+    return SUCCESS;
+}
+
+/**
+ * ListMultisetWordCount() fills in wordCount as SortedWordCount() would for the list
+ * ListMultisetToList() makes: for each word, its count at its first occurrence and the negative of
+ * its count at every repeat, and 0 for NULLs. After ListMultisetSort() that is exactly the output
+ * for the sorted list.
+ *
+ * @param set An initialized multiset.
+ * @param wordCount Where to store the counts. Must hold at least set->total ints.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int ListMultisetWordCount(const ListMultiset *set, int *wordCount)
+{
+    ListMultisetItem *item;
+    int i;
+    if (set == NULL || wordCount == NULL) {
+        return STANDARD_ERROR;
+    }
+    for (item = set->head; item != NULL; item = item->nextItem) {
+        if (item->data == NULL) {
+            memset(wordCount, 0, item->count * sizeof (int));
+            wordCount += item->count;
+            continue;
+        }
+        *wordCount++ = item->count;
+        for (i = 1; i < item->count; i++) {
+            *wordCount++ = -item->count;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListMultisetFree() frees every item and the index. The words themselves are left alone. The
+ * multiset must be initialized again before it is reused.
+ *
+ * @param set The multiset to free.
+ */
+void ListMultisetFree(ListMultiset *set)
+{
+    ListMultisetItem *next;
+    if (set == NULL) {
+        return;
+    }
+    while (set->head != NULL) {
+        next = set->head->nextItem;
+        free(set->head);
+        set->head = next;
+    }
+    WordTableFree(&set->index);
+    free(set->items);
+    memset(set, 0, sizeof (ListMultiset));
+}
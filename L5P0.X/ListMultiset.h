@@ -0,0 +1,123 @@
+#ifndef LISTMULTISET_H
+#define LISTMULTISET_H
+
+#include "LinkedList.h"
+#include "WordCount.h"
+
+/**
+ * @file
+ * A run-length encoded variant of the list for word lists full of repeats. Each ListMultisetItem
+ * holds one distinct word and how many times it occurs, so adding a word that is already there only
+ * bumps a count, and counting walks each distinct word once instead of every occurrence. Items are
+ * kept in the order their words first appeared until ListMultisetSort() puts them in
+ * LinkedListSort() order. A WordTable index over the items makes finding a word O(1) on average.
+ *
+ * ListMultisetFromList() and ListMultisetToList() convert to and from regular lists, and
+ * ListMultisetWordCount() produces the same wordCount array that SortedWordCount() would for the
+ * list the multiset stands for.
+ *
+ * Words are not copied, so like a regular list the multiset only stores pointers to them. NULL is
+ * counted like any other word.
+ */
+
+/**
+ * One distinct word and its number of occurrences.
+ */
+typedef struct ListMultisetItem {
+    struct ListMultisetItem *previousItem;
+    struct ListMultisetItem *nextItem;
+    char *data;
+    int count;
+} ListMultisetItem;
+
+/**
+ * A multiset of words. Set it up with ListMultisetInit().
+ */
+typedef struct ListMultiset {
+    ListMultisetItem *head;
+    ListMultisetItem *tail;
+    WordTable index; //each word's position in items, by contents
+    ListMultisetItem **items; //every item, in the order they were added
+    ListMultisetItem *nullItem; //NULL words are kept out of the index
+    int capacity; //size of items
+    int distinct; //number of items
+    int total; //sum of all counts
+} ListMultiset;
+
+/**
+ * ListMultisetInit() prepares an empty multiset.
+ *
+ * @param set The multiset to set up.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL or malloc() fails.
+ */
+int ListMultisetInit(ListMultiset *set);
+
+/**
+ * ListMultisetAdd() adds count occurrences of word. If the word is already in the multiset its
+ * count goes up; otherwise a new item is appended at the tail.
+ *
+ * @param set An initialized multiset.
+ * @param word The word to add. Can be NULL.
+ * @param count How many occurrences to add. Must be positive.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL, count isn't positive or malloc() fails.
+ */
+int ListMultisetAdd(ListMultiset *set, char *word, int count);
+
+/**
+ * ListMultisetFind() looks up the item holding a word, comparing by contents.
+ *
+ * @param set An initialized multiset.
+ * @param word The word to find. Can be NULL.
+ * @return The word's item, or NULL if it isn't in the multiset.
+ */
+ListMultisetItem *ListMultisetFind(const ListMultiset *set, const char *word);
+
+/**
+ * ListMultisetFromList() adds every item of a regular list to a multiset.
+ *
+ * @param set An initialized multiset.
+ * @param list Any element in the list to add.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or malloc() fails.
+ */
+int ListMultisetFromList(ListMultiset *set, ListItem *list);
+
+/**
+ * ListMultisetToList() builds a regular list with every occurrence in the multiset, in the
+ * multiset's order, each word repeated count times.
+ *
+ * @param set An initialized multiset.
+ * @return The head of the new list, or NULL if the multiset is empty or malloc() fails.
+ */
+ListItem *ListMultisetToList(const ListMultiset *set);
+
+/**
+ * ListMultisetSort() puts the items in the same order as LinkedListSort() (NULL first, then by
+ * length, then alphabetically). Only the distinct words are sorted, so this costs
+ * O(d log d) for d distinct words however many occurrences there are.
+ *
+ * @param set An initialized multiset.
+ * @return SUCCESS or STANDARD_ERROR if set is NULL.
+ */
+int ListMultisetSort(ListMultiset *set);
+
+/**
+ * ListMultisetWordCount() fills in wordCount as SortedWordCount() would for the list
+ * ListMultisetToList() makes: for each word, its count at its first occurrence and the negative of
+ * its count at every repeat, and 0 for NULLs. After ListMultisetSort() that is exactly the output
+ * for the sorted list.
+ *
+ * @param set An initialized multiset.
+ * @param wordCount Where to store the counts. Must hold at least set->total ints.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int ListMultisetWordCount(const ListMultiset *set, int *wordCount);
+
+/**
+ * ListMultisetFree() frees every item and the index. The words themselves are left alone. The
+ * multiset must be initialized again before it is reused.
+ *
+ * @param set The multiset to free.
+ */
+void ListMultisetFree(ListMultiset *set);
+
+#endif
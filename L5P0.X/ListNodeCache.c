@@ -0,0 +1,208 @@
+/*
+ * File:   ListNodeCache.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "ListNodeCache.h"
+#include "BOARD.h"
+
+/*
+ * A thread's free items, chained through nextItem.
+ */
+typedef struct ListNodeCache {
+    ListItem *nodes;
+    int count;
+    int registered; //TRUE once the cache will be flushed when the thread exits
+} ListNodeCache;
+
+static __thread ListNodeCache cache;
+
+//batches waiting in the depot: each is a chain through nextItem, and the batches are chained
+//through their first items' previousItem
+static pthread_mutex_t depotLock = PTHREAD_MUTEX_INITIALIZER;
+static ListItem *depot = NULL;
+static int depotBatches = 0;
+
+//runs ListNodeCacheExit() for every thread with a registered cache
+static pthread_once_t exitKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t exitKey;
+static int exitKeyStatus = STANDARD_ERROR;
+
+/*
+ * Frees every item in a chain and returns how many there were.
+ */
+static int ListNodeCacheFreeChain(ListItem *chain)
+{
+    ListItem *next;
+    int count = 0;
+    while (chain != NULL) {
+        next = chain->nextItem;
+        free(chain);
+        chain = next;
+        count++;
+    }
+    LinkedListAccountItems(count, FALSE);
+    return count;
+}
+
+/*
+ * Puts a batch in the depot, or frees it if the depot is full and force is FALSE.
+ */
+static void ListNodeCachePush(ListItem *batch, int force)
+{
+    pthread_mutex_lock(&depotLock);
+    if (force || depotBatches < LIST_NODE_CACHE_DEPOT_BATCHES) {
+        batch->previousItem = depot;
+        depot = batch;
+        depotBatches++;
+        batch = NULL;
+    }
+    pthread_mutex_unlock(&depotLock);
+    ListNodeCacheFreeChain(batch);
+}
+
+/*
+ * Takes a batch from the depot, or returns NULL if it is empty.
+ */
+static ListItem *ListNodeCachePop(void)
+{
+    ListItem *batch;
+    pthread_mutex_lock(&depotLock);
+    batch = depot;
+    if (batch != NULL) {
+        depot = batch->previousItem;
+        depotBatches--;
+    }
+    pthread_mutex_unlock(&depotLock);
+    return batch;
+}
+
+/*
+ * Thread-exit destructor: moves what is left in the thread's cache to the depot, even if it is
+ * full, so another thread can use the items or ListNodeCacheDrain() can free them.
+ */
+static void ListNodeCacheExit(void *context)
+{
+    ListNodeCache *exiting = context;
+    if (exiting->nodes != NULL) {
+        ListNodeCachePush(exiting->nodes, TRUE);
+    }
+    exiting->nodes = NULL;
+    exiting->count = 0;
+    exiting->registered = FALSE;
+}
+
+static void ListNodeCacheCreateExitKey(void)
+{
+    if (pthread_key_create(&exitKey, ListNodeCacheExit) == 0) {
+        exitKeyStatus = SUCCESS;
+    }
+}
+
+/*
+ * Makes sure the calling thread's cache is flushed when it exits. Called before the cache is given
+ * any items. If the key can't be made, items in the caches of exiting threads are lost.
+ */
+static void ListNodeCacheRegister(void)
+{
+    if (!cache.registered) {
+        pthread_once(&exitKeyOnce, ListNodeCacheCreateExitKey);
+        if (exitKeyStatus == SUCCESS) {
+            pthread_setspecific(exitKey, &cache);
+        }
+        cache.registered = TRUE;
+    }
+}
+
+/**
+ * ListNodeCacheAllocate() returns an unused ListItem, from the calling thread's cache if it has
+ * one, then from the depot, then from malloc(). Its contents are undefined.
+ *
+ * @return The item, or NULL if malloc() fails.
+ */
+ListItem *ListNodeCacheAllocate(void)
+{
+    ListItem *item;
+    if (cache.nodes == NULL) {
+        item = ListNodeCachePop();
+        if (item == NULL) {
+            item = malloc(sizeof (ListItem));
+            if (item != NULL) {
+                LinkedListAccountItems(1, TRUE);
+            }
+            return item;
+        }
+        ListNodeCacheRegister();
+        cache.nodes = item;
+        for (cache.count = 0; item != NULL; item = item->nextItem) {
+            cache.count++;
+        }
+    }
+    item = cache.nodes;
+    cache.nodes = item->nextItem;
+    cache.count--;
+    return item;
+}
+
+/**
+ * ListNodeCacheFree() takes back an item from ListNodeCacheAllocate(), on any thread, and keeps it
+ * in the calling thread's cache for reuse.
+ *
+ * @param item The item to free. Must no longer be linked into any list. NULL is ignored.
+ */
+void ListNodeCacheFree(ListItem *item)
+{
+    ListItem *last;
+    int i;
+    if (item == NULL) {
+        return;
+    }
+    ListNodeCacheRegister();
+    item->nextItem = cache.nodes;
+    cache.nodes = item;
+    if (++cache.count < 2 * LIST_NODE_CACHE_BATCH) {
+        return;
+    }
+    //keep the most recently freed half, which is most likely still in the CPU cache, and pass the
+    //older half on to the depot
+    last = cache.nodes;
+    for (i = 1; i < LIST_NODE_CACHE_BATCH; i++) {
+        last = last->nextItem;
+    }
+    item = last->nextItem;
+    last->nextItem = NULL;
+    cache.count = LIST_NODE_CACHE_BATCH;
+    ListNodeCachePush(item, FALSE);
+}
+
+/**
+ * ListNodeCacheDrain() gives the items in the calling thread's cache and in the depot back to
+ * free(). Other threads' caches are left alone.
+ *
+ * @return How many items were freed.
+ */
+int ListNodeCacheDrain(void)
+{
+    ListItem *batch, *next;
+    int count;
+    pthread_mutex_lock(&depotLock);
+    batch = depot;
+    depot = NULL;
+    depotBatches = 0;
+    pthread_mutex_unlock(&depotLock);
+
+    count = ListNodeCacheFreeChain(cache.nodes);
+    cache.nodes = NULL;
+    cache.count = 0;
+    while (batch != NULL) {
+        next = batch->previousItem;
+        count += ListNodeCacheFreeChain(batch);
+        batch = next;
+    }
+    return count;
+}
@@ -0,0 +1,72 @@
+#ifndef LISTNODECACHE_H
+#define LISTNODECACHE_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * A ListItem allocator for host programs where several threads build and tear down lists at the
+ * same time. Each thread keeps a cache of free ListItems of its own, so most allocations and frees
+ * touch no shared state at all. When a thread's cache fills up, it hands LIST_NODE_CACHE_BATCH
+ * items at once to a shared depot, and when it runs dry it takes a whole batch back, so the depot's
+ * lock is only taken once per batch. The depot holds at most LIST_NODE_CACHE_DEPOT_BATCHES batches;
+ * beyond that, items go back to free().
+ *
+ * Items may be freed by a different thread than the one that allocated them: they simply go into
+ * the freeing thread's cache. A thread that only frees (a consumer) passes full batches to the
+ * depot, where a thread that only allocates (a producer) picks them up. A thread's cache is moved
+ * to the depot when the thread exits.
+ *
+ * LinkedList.c uses this for every ListItem that isn't part of a block when it is built with
+ * LINKEDLIST_NODE_CACHE defined. Cached items are still on the heap, so the cache reports its own
+ * malloc() and free() calls to LinkedList.c's heap accounting instead, which means this file must
+ * be linked with a LinkedList.c built that way. This is host-only, as it needs pthreads and
+ * thread-local storage, and is left out of the board build.
+ */
+
+// How many items move between a thread's cache and the depot at once. A cache holds up to twice
+// this many.
+#ifndef LIST_NODE_CACHE_BATCH
+#define LIST_NODE_CACHE_BATCH 64
+#endif
+
+// How many batches the depot holds before items are given back to free().
+#ifndef LIST_NODE_CACHE_DEPOT_BATCHES
+#define LIST_NODE_CACHE_DEPOT_BATCHES 64
+#endif
+
+/**
+ * LinkedListAccountItems() adds count ListItems to the heap LinkedListHeapInUse() reports (take
+ * TRUE) or takes them off it (take FALSE). It is defined in LinkedList.c, and the cache calls it
+ * whenever it malloc()s an item or free()s items.
+ *
+ * @param count How many items.
+ * @param take TRUE for items malloc()ed, FALSE for items free()d.
+ */
+void LinkedListAccountItems(int count, int take);
+
+/**
+ * ListNodeCacheAllocate() returns an unused ListItem, from the calling thread's cache if it has
+ * one, then from the depot, then from malloc(). Its contents are undefined.
+ *
+ * @return The item, or NULL if malloc() fails.
+ */
+ListItem *ListNodeCacheAllocate(void);
+
+/**
+ * ListNodeCacheFree() takes back an item from ListNodeCacheAllocate(), on any thread, and keeps it
+ * in the calling thread's cache for reuse.
+ *
+ * @param item The item to free. Must no longer be linked into any list. NULL is ignored.
+ */
+void ListNodeCacheFree(ListItem *item);
+
+/**
+ * ListNodeCacheDrain() gives the items in the calling thread's cache and in the depot back to
+ * free(). Other threads' caches are left alone.
+ *
+ * @return How many items were freed.
+ */
+int ListNodeCacheDrain(void);
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * File:   ListPipeline.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+
+//threads are only available on the host, the board tokenizes and builds one word at a time
+#ifndef __XC32
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "ListPipeline.h"
+#include "ListTokenizer.h"
+#include "BOARD.h"
+
+#define LIST_PIPELINE_RING_MASK (LIST_PIPELINE_RING_SIZE - 1)
+
+//keeps the fields each thread writes on cache lines of their own
+#define LIST_PIPELINE_LINE_BYTES 64
+
+//the ring's indices are shared between the threads, so they are read with acquire and written with
+//release ordering: a published index guarantees the slots (and words) before it are visible
+#define LIST_PIPELINE_LOAD(index) __atomic_load_n((index), __ATOMIC_ACQUIRE)
+#define LIST_PIPELINE_STORE(index, value) __atomic_store_n((index), (value), __ATOMIC_RELEASE)
+
+/*
+ * The state shared by the tokenizer and the builder.
+ */
+typedef struct ListPipeline {
+    //written by the tokenizer, read by the builder
+    unsigned long published; //words in the ring the builder may take
+    int done; //set once the last word is published
+    int tokenizeStatus;
+    char tokenizerPad[LIST_PIPELINE_LINE_BYTES];
+
+    //written by the builder, read by the tokenizer
+    unsigned long consumed; //words the builder has taken, so their slots can be reused
+    int failed; //set if the builder ran out of memory, so the tokenizer can stop
+    char builderPad[LIST_PIPELINE_LINE_BYTES];
+
+    //only used by the tokenizer
+    unsigned long produced; //words written to the ring, published or not
+    unsigned long knownConsumed; //last value of consumed the tokenizer saw
+
+    //set up before the threads start
+    char **slots;
+    unsigned long batch;
+    char *buffer;
+    unsigned long length;
+    int options;
+    ListItem **tail;
+    ListMultiset *counts;
+} ListPipeline;
+
+/*
+ * Appends a word to the list and/or adds it to the counts.
+ */
+static int ListPipelineTake(char *word, void *context)
+{
+    ListPipeline *pipeline = context;
+    ListItem *item;
+    if (pipeline->tail != NULL) {
+        item = LinkedListCreateAfter(*pipeline->tail, word);
+        if (item == NULL) {
+            return STANDARD_ERROR;
+        }
+        *pipeline->tail = item;
+    }
+    if (pipeline->counts != NULL) {
+        return ListMultisetAdd(pipeline->counts, word, 1);
+    }
+    return SUCCESS;
+}
+
+#ifndef __XC32
+
+/*
+ * ListWordCallback for the tokenizer thread: writes a word to the ring, publishing a batch at a
+ * time and waiting for the builder whenever the ring is full.
+ */
+static int ListPipelinePush(char *word, void *context)
+{
+    ListPipeline *pipeline = context;
+    while (pipeline->produced - pipeline->knownConsumed == LIST_PIPELINE_RING_SIZE) {
+        //let the builder have everything before waiting on it
+        LIST_PIPELINE_STORE(&pipeline->published, pipeline->produced);
+        pipeline->knownConsumed = LIST_PIPELINE_LOAD(&pipeline->consumed);
+        if (pipeline->produced - pipeline->knownConsumed == LIST_PIPELINE_RING_SIZE) {
+            if (LIST_PIPELINE_LOAD(&pipeline->failed)) {
+                return STANDARD_ERROR;
+            }
+            sched_yield();
+        }
+    }
+    pipeline->slots[pipeline->produced & LIST_PIPELINE_RING_MASK] = word;
+    pipeline->produced++;
+    if (pipeline->produced % pipeline->batch == 0) {
+        LIST_PIPELINE_STORE(&pipeline->published, pipeline->produced);
+        if (LIST_PIPELINE_LOAD(&pipeline->failed)) {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/*
+ * The tokenizer thread.
+ */
+static void *ListPipelineTokenize(void *context)
+{
+    ListPipeline *pipeline = context;
+    pipeline->tokenizeStatus = ListTokenizeEach(pipeline->buffer, pipeline->length,
+            pipeline->options, ListPipelinePush, pipeline);
+    LIST_PIPELINE_STORE(&pipeline->published, pipeline->produced);
+    LIST_PIPELINE_STORE(&pipeline->done, TRUE);
+    return NULL;
+}
+
+/*
+ * The builder, run on the calling thread: takes every published word until the tokenizer is done.
+ * After a failure it keeps emptying the ring without taking the words, so the tokenizer can't get
+ * stuck on a full ring before it notices.
+ */
+static int ListPipelineBuild(ListPipeline *pipeline)
+{
+    unsigned long consumed = 0, available;
+    int status = SUCCESS;
+    while (TRUE) {
+        available = LIST_PIPELINE_LOAD(&pipeline->published);
+        if (available == consumed) {
+            if (!LIST_PIPELINE_LOAD(&pipeline->done)) {
+                sched_yield();
+                continue;
+            }
+            //done is set after the last publish, so this read sees every word
+            available = LIST_PIPELINE_LOAD(&pipeline->published);
+            if (available == consumed) {
+                return status;
+            }
+        }
+        for (; consumed != available; consumed++) {
+            if (status == SUCCESS) {
+                status = ListPipelineTake(pipeline->slots[consumed & LIST_PIPELINE_RING_MASK],
+                        pipeline);
+            }
+        }
+        LIST_PIPELINE_STORE(&pipeline->consumed, consumed);
+        if (status != SUCCESS) {
+            LIST_PIPELINE_STORE(&pipeline->failed, TRUE);
+        }
+    }
+}
+
+#endif
+
+/**
+ * ListPipelineIngest() splits buffer like ListTokenizeEach() and, as the words come out, appends
+ * each one to a list and/or adds it to a multiset. The result is the same as ListTokenize()
+ * followed by ListMultisetFromList(), but the two halves overlap.
+ *
+ * @param buffer The text to split, changed in place as for ListTokenize(), so it must outlive the
+ *               list and the multiset.
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param batch How many words the tokenizer hands over at once, from 1 to
+ *              LIST_PIPELINE_RING_SIZE / 2. Bigger batches mean less traffic between the threads
+ *              but a longer wait before the builder gets going.
+ * @param tail[in,out] The item to append the words after, or a pointer to NULL to start a new list.
+ *                     Updated to the last item added. Can be NULL to only count.
+ * @param counts An initialized multiset to add the words to. Can be NULL to only build the list.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers (tail and counts can't both be NULL),
+ *         a bad batch or malloc() failed (the words added before the failure are kept).
+ */
+int ListPipelineIngest(char *buffer, unsigned long length, int options, int batch,
+        ListItem **tail, ListMultiset *counts)
+{
+    ListPipeline pipeline = {0};
+#ifndef __XC32
+    pthread_t tokenizer;
+    int status;
+#endif
+    if (buffer == NULL || (tail == NULL && counts == NULL) || batch < 1
+            || batch > LIST_PIPELINE_RING_SIZE / 2) {
+        return STANDARD_ERROR;
+    }
+    pipeline.batch = batch;
+    pipeline.buffer = buffer;
+    pipeline.length = length;
+    pipeline.options = options;
+    pipeline.tail = tail;
+    pipeline.counts = counts;
+
+#ifndef __XC32
+    pipeline.slots = malloc(LIST_PIPELINE_RING_SIZE * sizeof (char *));
+    if (pipeline.slots != NULL
+            && pthread_create(&tokenizer, NULL, ListPipelineTokenize, &pipeline) == 0) {
+        status = ListPipelineBuild(&pipeline);
+        pthread_join(tokenizer, NULL);
+        free(pipeline.slots);
+        if (status == SUCCESS && pipeline.tokenizeStatus == SUCCESS) {
+            return SUCCESS;
+        }
+        return STANDARD_ERROR;
+    }
+    //without a ring or a thread, fall back to doing it all here
+    free(pipeline.slots);
+#endif
+    return ListTokenizeEach(buffer, length, options, ListPipelineTake, &pipeline);
+}
@@ -0,0 +1,49 @@
+#ifndef LISTPIPELINE_H
+#define LISTPIPELINE_H
+
+#include "LinkedList.h"
+#include "ListMultiset.h"
+
+/**
+ * @file
+ * Pipelined ingest: splits raw text into words and builds a list and/or counts them at the same
+ * time instead of one step after the other. On the host the tokenizer runs on its own thread and
+ * passes word pointers through a lock-free single-producer/single-consumer ring buffer to the
+ * calling thread, which appends them to the list and adds them to a ListMultiset. The ring's
+ * indices are only published once per batch of words, so the two threads touch each other's cache
+ * lines rarely.
+ *
+ * On the board there are no threads, so every word goes straight from the tokenizer to the list
+ * and counts, with the same result.
+ */
+
+// How many word pointers the ring buffer holds. Must be a power of 2.
+#ifndef LIST_PIPELINE_RING_SIZE
+#define LIST_PIPELINE_RING_SIZE 4096
+#endif
+
+// A reasonable default batch for ListPipelineIngest().
+#define LIST_PIPELINE_BATCH 64
+
+/**
+ * ListPipelineIngest() splits buffer like ListTokenizeEach() and, as the words come out, appends
+ * each one to a list and/or adds it to a multiset. The result is the same as ListTokenize()
+ * followed by ListMultisetFromList(), but the two halves overlap.
+ *
+ * @param buffer The text to split, changed in place as for ListTokenize(), so it must outlive the
+ *               list and the multiset.
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param batch How many words the tokenizer hands over at once, from 1 to
+ *              LIST_PIPELINE_RING_SIZE / 2. Bigger batches mean less traffic between the threads
+ *              but a longer wait before the builder gets going.
+ * @param tail[in,out] The item to append the words after, or a pointer to NULL to start a new list.
+ *                     Updated to the last item added. Can be NULL to only count.
+ * @param counts An initialized multiset to add the words to. Can be NULL to only build the list.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers (tail and counts can't both be NULL),
+ *         a bad batch or malloc() failed (the words added before the failure are kept).
+ */
+int ListPipelineIngest(char *buffer, unsigned long length, int options, int batch,
+        ListItem **tail, ListMultiset *counts);
+
+#endif
@@ -0,0 +1,394 @@
+/*
+ * File:   ListSnapshot.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//mmap() only exists on the host
+#ifndef __XC32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ListSnapshot.h"
+#include "BOARD.h"
+
+/*
+ * Where the records and string blob start for a snapshot of count items.
+ */
+#define RECORDS_OFFSET (sizeof (ListSnapshotHeader))
+#define STRINGS_OFFSET(count) (RECORDS_OFFSET + (count) * sizeof (ListSnapshotRecord))
+
+/**
+ * ListSnapshotEncodedSize() returns how many bytes ListSnapshotEncode() needs for a list.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @return The size of the snapshot in bytes.
+ */
+unsigned long ListSnapshotEncodedSize(ListItem *list)
+{
+    ListCursor cursor;
+    unsigned long count = 0, stringBytes = 0;
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((list = LinkedListCursorNext(&cursor)) != NULL) {
+        count++;
+        if (list->data != NULL) {
+            stringBytes += strlen(list->data) + 1;
+        }
+    }
+    return STRINGS_OFFSET(count) + stringBytes;
+}
+
+/**
+ * ListSnapshotEncode() writes a snapshot of a list into buffer. The records are written in list
+ * order starting from the head, so item i of the list is record i.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @param buffer Where to write the snapshot. Must be aligned for a uint32_t.
+ * @param size How many bytes fit in buffer.
+ * @return SUCCESS, SIZE_ERROR if buffer is smaller than ListSnapshotEncodedSize() or
+ *         STANDARD_ERROR if buffer is NULL.
+ */
+int ListSnapshotEncode(ListItem *list, void *buffer, unsigned long size)
+{
+    ListCursor cursor;
+    ListSnapshotHeader *header = buffer;
+    ListSnapshotRecord *records;
+    char *strings;
+    uint32_t count, i, stringBytes = 0;
+    size_t length;
+    if (buffer == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (size < ListSnapshotEncodedSize(list)) {
+        return SIZE_ERROR;
+    }
+    list = LinkedListGetFirst(list);
+    count = LinkedListSize(list);
+    records = (ListSnapshotRecord *) ((char *) buffer + RECORDS_OFFSET);
+    strings = (char *) buffer + STRINGS_OFFSET(count);
+
+    LinkedListCursorInit(&cursor, list, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    for (i = 0; i < count; i++) {
+        list = LinkedListCursorNext(&cursor);
+        records[i].previousItem = (i > 0) ? i - 1 : LIST_SNAPSHOT_NONE;
+        records[i].nextItem = (i < count - 1) ? i + 1 : LIST_SNAPSHOT_NONE;
+        if (list->data == NULL) {
+            records[i].data = LIST_SNAPSHOT_NONE;
+        } else {
+            length = strlen(list->data) + 1;
+            memcpy(strings + stringBytes, list->data, length);
+            records[i].data = stringBytes;
+            stringBytes += length;
+        }
+    }
+    header->magic = LIST_SNAPSHOT_MAGIC;
+    header->count = count;
+    header->head = (count > 0) ? 0 : LIST_SNAPSHOT_NONE;
+    header->stringBytes = stringBytes;
+    return SUCCESS;
+}
+
+/**
+ * ListSnapshotWrite() writes a snapshot of a list to a file. Only available on the host; on the
+ * board it always returns STANDARD_ERROR.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @param path The file to create or overwrite.
+ * @return SUCCESS or STANDARD_ERROR if the file couldn't be written.
+ */
+int ListSnapshotWrite(ListItem *list, const char *path)
+{
+#ifdef __XC32
+    return STANDARD_ERROR;
+#else
+    unsigned long size = ListSnapshotEncodedSize(list);
+    uint32_t *buffer;
+    FILE *file;
+    int status = STANDARD_ERROR;
+    if (path == NULL) {
+        return STANDARD_ERROR;
+    }
+    //uint32_t words keep the buffer aligned for the header and records
+    buffer = malloc(size + sizeof (uint32_t));
+    if (buffer == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (ListSnapshotEncode(list, buffer, size) == SUCCESS) {
+        file = fopen(path, "wb");
+        if (file != NULL) {
+            if (fwrite(buffer, 1, size, file) == size) {
+                status = SUCCESS;
+            }
+            if (fclose(file) != 0) {
+                status = STANDARD_ERROR;
+            }
+        }
+    }
+    free(buffer);
+    return status;
+#endif
+}
+
+/*
+ * Follows the nextItem links from the head and checks that they visit every record exactly once,
+ * with each record's previousItem pointing back at the one before it, and end at
+ * LIST_SNAPSHOT_NONE. Without this a corrupt file could send a walk round a cycle forever.
+ */
+static int ListSnapshotCheckChain(const ListSnapshotHeader *header,
+        const ListSnapshotRecord *records)
+{
+    uint32_t index = header->head, previous = LIST_SNAPSHOT_NONE, steps;
+    for (steps = 0; steps < header->count; steps++) {
+        if (index >= header->count || records[index].previousItem != previous) {
+            return STANDARD_ERROR;
+        }
+        previous = index;
+        index = records[index].nextItem;
+    }
+    return (index == LIST_SNAPSHOT_NONE) ? SUCCESS : STANDARD_ERROR;
+}
+
+/**
+ * ListSnapshotView() sets up snapshot to read the snapshot stored in buffer. The header is checked,
+ * and so is the chain of links from the head, so that walking the snapshot always ends: that takes
+ * one pass over the records, but the strings aren't touched. buffer must stay valid (and
+ * unchanged) for as long as snapshot is used.
+ *
+ * @param snapshot The view to set up.
+ * @param buffer A snapshot written by ListSnapshotEncode(). Must be aligned for a uint32_t.
+ * @param size The size of buffer in bytes.
+ * @return SUCCESS, or STANDARD_ERROR if buffer doesn't hold a well-formed snapshot header or its
+ *         links don't form a single chain through every record.
+ */
+int ListSnapshotView(ListSnapshot *snapshot, const void *buffer, unsigned long size)
+{
+    const ListSnapshotHeader *header = buffer;
+    const ListSnapshotRecord *records;
+    if (snapshot == NULL || buffer == NULL || size < sizeof (ListSnapshotHeader)) {
+        return STANDARD_ERROR;
+    }
+    //the sizes have to add up exactly and the blob has to end in a NUL, which is enough to keep
+    //every in-range offset from reading past the end
+    if (header->magic != LIST_SNAPSHOT_MAGIC
+            || header->count > (size - RECORDS_OFFSET) / sizeof (ListSnapshotRecord)
+            || STRINGS_OFFSET((unsigned long) header->count) + header->stringBytes != size
+            || (header->count > 0 && header->head >= header->count)
+            || (header->stringBytes > 0 && ((const char *) buffer)[size - 1] != '\0')) {
+        return STANDARD_ERROR;
+    }
+    records = (const ListSnapshotRecord *) ((const char *) buffer + RECORDS_OFFSET);
+    if (ListSnapshotCheckChain(header, records) == STANDARD_ERROR) {
+        return STANDARD_ERROR;
+    }
+    snapshot->header = header;
+    snapshot->records = records;
+    snapshot->strings = (const char *) buffer + STRINGS_OFFSET(header->count);
+    snapshot->size = size;
+    snapshot->mapped = FALSE;
+    return SUCCESS;
+}
+
+/**
+ * ListSnapshotOpen() mmap()s a snapshot file written by ListSnapshotWrite() and sets up snapshot to
+ * read it. The records are checked as for ListSnapshotView(), but the strings are only loaded as
+ * they are used. Only available on the host; on the board it always returns STANDARD_ERROR.
+ *
+ * @param snapshot The view to set up.
+ * @param path The snapshot file.
+ * @return SUCCESS or STANDARD_ERROR if the file couldn't be mapped or isn't a snapshot.
+ */
+int ListSnapshotOpen(ListSnapshot *snapshot, const char *path)
+{
+#ifdef __XC32
+    return STANDARD_ERROR;
+#else
+    struct stat info;
+    void *mapping;
+    int file;
+    if (snapshot == NULL || path == NULL) {
+        return STANDARD_ERROR;
+    }
+    file = open(path, O_RDONLY);
+    if (file < 0) {
+        return STANDARD_ERROR;
+    }
+    if (fstat(file, &info) != 0 || info.st_size < (off_t) sizeof (ListSnapshotHeader)) {
+        close(file);
+        return STANDARD_ERROR;
+    }
+    mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    //the mapping keeps the file alive on its own
+    close(file);
+    if (mapping == MAP_FAILED) {
+        return STANDARD_ERROR;
+    }
+    if (ListSnapshotView(snapshot, mapping, info.st_size) == STANDARD_ERROR) {
+        munmap(mapping, info.st_size);
+        return STANDARD_ERROR;
+    }
+    snapshot->mapped = TRUE;
+    return SUCCESS;
+#endif
+}
+
+/**
+ * ListSnapshotClose() unmaps a snapshot opened with ListSnapshotOpen(). Does nothing for one set up
+ * with ListSnapshotView().
+ *
+ * @param snapshot The snapshot to close.
+ */
+void ListSnapshotClose(ListSnapshot *snapshot)
+{
+    if (snapshot == NULL || snapshot->header == NULL) {
+        return;
+    }
+#ifndef __XC32
+    if (snapshot->mapped) {
+        munmap((void *) snapshot->header, snapshot->size);
+    }
+#endif
+    snapshot->header = NULL;
+    snapshot->records = NULL;
+    snapshot->strings = NULL;
+}
+
+/**
+ * ListSnapshotSize() returns the number of items in a snapshot, in constant time.
+ *
+ * @param snapshot An open snapshot.
+ * @return The number of items.
+ */
+int ListSnapshotSize(const ListSnapshot *snapshot)
+{
+    return snapshot->header->count;
+}
+
+/**
+ * ListSnapshotFirst() returns the record index of the snapshot's head.
+ *
+ * @param snapshot An open snapshot.
+ * @return The index of the first item, or -1 if the snapshot is empty.
+ */
+int ListSnapshotFirst(const ListSnapshot *snapshot)
+{
+    return (snapshot->header->count > 0) ? (int) snapshot->header->head : -1;
+}
+
+/**
+ * ListSnapshotNext() returns the record index of the item after index.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The index of the next item, or -1 at the tail or if index is out of range.
+ */
+int ListSnapshotNext(const ListSnapshot *snapshot, int index)
+{
+    uint32_t next;
+    if (index < 0 || (uint32_t) index >= snapshot->header->count) {
+        return -1;
+    }
+    next = snapshot->records[index].nextItem;
+    return (next < snapshot->header->count) ? (int) next : -1;
+}
+
+/**
+ * ListSnapshotPrevious() returns the record index of the item before index.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The index of the previous item, or -1 at the head or if index is out of range.
+ */
+int ListSnapshotPrevious(const ListSnapshot *snapshot, int index)
+{
+    uint32_t previous;
+    if (index < 0 || (uint32_t) index >= snapshot->header->count) {
+        return -1;
+    }
+    previous = snapshot->records[index].previousItem;
+    return (previous < snapshot->header->count) ? (int) previous : -1;
+}
+
+/**
+ * ListSnapshotData() returns the string stored in an item, pointing straight into the snapshot.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The item's string, or NULL if the item holds NULL or index is out of range.
+ */
+const char *ListSnapshotData(const ListSnapshot *snapshot, int index)
+{
+    uint32_t data;
+    if (index < 0 || (uint32_t) index >= snapshot->header->count) {
+        return NULL;
+    }
+    data = snapshot->records[index].data;
+    return (data < snapshot->header->stringBytes) ? snapshot->strings + data : NULL;
+}
+
+/**
+ * ListSnapshotPrint() prints a snapshot the same way LinkedListPrint() prints a list.
+ *
+ * @param snapshot An open snapshot.
+ * @return SUCCESS or STANDARD_ERROR if passed a NULL pointer or an empty snapshot.
+ */
+int ListSnapshotPrint(const ListSnapshot *snapshot)
+{
+    const char *data;
+    int index, next;
+    if (snapshot == NULL || snapshot->header == NULL || ListSnapshotFirst(snapshot) < 0) {
+        return STANDARD_ERROR;
+    }
+    printf("[");
+    for (index = ListSnapshotFirst(snapshot); index >= 0; index = next) {
+        next = ListSnapshotNext(snapshot, index);
+        data = ListSnapshotData(snapshot, index);
+        //printf() can't be given NULL for %s, so NULL items are spelled out
+        printf(next >= 0 ? "%s " : "%s", (data != NULL) ? data : "(null)");
+    }
+    printf("]\n");
+    return SUCCESS;
+}
+
+/**
+ * ListSnapshotToList() builds a regular, modifiable list holding the same items as a snapshot.
+ * The ListItems are new, but their data still points into the snapshot, so the snapshot must stay
+ * open for as long as the list is used and the strings must not be written to.
+ *
+ * @param snapshot An open snapshot.
+ * @return The head of the new list, or NULL if the snapshot is empty or allocation failed.
+ */
+ListItem *ListSnapshotToList(const ListSnapshot *snapshot)
+{
+    ListItem *head, *tail;
+    int index;
+    if (snapshot == NULL || snapshot->header == NULL || ListSnapshotFirst(snapshot) < 0) {
+        return NULL;
+    }
+    index = ListSnapshotFirst(snapshot);
+    head = LinkedListNew((char *) ListSnapshotData(snapshot, index));
+    tail = head;
+    while (tail != NULL && (index = ListSnapshotNext(snapshot, index)) >= 0) {
+        if (LinkedListCreateAfter(tail, (char *) ListSnapshotData(snapshot, index)) == NULL) {
+            break;
+        }
+        tail = tail->nextItem;
+    }
+    //on failure give back everything built so far
+    if (tail == NULL || index >= 0) {
+        while (head != NULL) {
+            tail = head->nextItem;
+            LinkedListRemove(head);
+            head = tail;
+        }
+    }
+    return head;
+}
@@ -0,0 +1,191 @@
+#ifndef LISTSNAPSHOT_H
+#define LISTSNAPSHOT_H
+
+#include <stdint.h>
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * A compact binary snapshot of a list and all of its strings, so that large word lists don't have
+ * to be rebuilt item by item at every startup. A snapshot is laid out as:
+ *
+ *     ListSnapshotHeader
+ *     ListSnapshotRecord[count]   one per item, in list order
+ *     string blob                 the NUL-terminated strings, one after another
+ *
+ * Records refer to each other by index and to their strings by offset into the blob, so nothing in
+ * a snapshot depends on where it ends up in memory. That means a snapshot can be used right where
+ * it sits, whether that is a const array in flash or a file mmap()ed on the host, without parsing
+ * it or allocating anything per item. Snapshots are read-only; ListSnapshotToList() makes a
+ * regular list out of one when it needs to be changed.
+ *
+ * A snapshot is deliberately not a list of ListItems: a ListItem links to its neighbours by
+ * pointer, and pointers would tie a snapshot to one address and need fixing up on every load. So
+ * the LinkedList*() functions and ListCursor can't walk a snapshot directly. Instead,
+ * ListSnapshotFirst(), ListSnapshotNext() and ListSnapshotData() walk it by index the same way, and
+ * ListSnapshotToList() is there for code that needs a real list and can afford a ListItem per item.
+ */
+
+// Marks an absent link or NULL data in a ListSnapshotRecord.
+#define LIST_SNAPSHOT_NONE 0xFFFFFFFFu
+
+// The first 4 bytes of every snapshot, "LLS1".
+#define LIST_SNAPSHOT_MAGIC 0x31534C4Cu
+
+/**
+ * The start of every snapshot.
+ */
+typedef struct ListSnapshotHeader {
+    uint32_t magic;
+    uint32_t count; //number of records
+    uint32_t head; //index of the first record, LIST_SNAPSHOT_NONE if empty
+    uint32_t stringBytes; //size of the string blob
+} ListSnapshotHeader;
+
+/**
+ * One list item. previousItem and nextItem are record indices, data is an offset into the string
+ * blob. Any of them can be LIST_SNAPSHOT_NONE.
+ */
+typedef struct ListSnapshotRecord {
+    uint32_t previousItem;
+    uint32_t nextItem;
+    uint32_t data;
+} ListSnapshotRecord;
+
+/**
+ * A read-only view of a snapshot. Set it up with ListSnapshotView() or ListSnapshotOpen().
+ */
+typedef struct ListSnapshot {
+    const ListSnapshotHeader *header;
+    const ListSnapshotRecord *records;
+    const char *strings;
+    unsigned long size; //total bytes, needed to unmap
+    int mapped;
+} ListSnapshot;
+
+/**
+ * ListSnapshotEncodedSize() returns how many bytes ListSnapshotEncode() needs for a list.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @return The size of the snapshot in bytes.
+ */
+unsigned long ListSnapshotEncodedSize(ListItem *list);
+
+/**
+ * ListSnapshotEncode() writes a snapshot of a list into buffer. The records are written in list
+ * order starting from the head, so item i of the list is record i.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @param buffer Where to write the snapshot. Must be aligned for a uint32_t.
+ * @param size How many bytes fit in buffer.
+ * @return SUCCESS, SIZE_ERROR if buffer is smaller than ListSnapshotEncodedSize() or
+ *         STANDARD_ERROR if buffer is NULL.
+ */
+int ListSnapshotEncode(ListItem *list, void *buffer, unsigned long size);
+
+/**
+ * ListSnapshotWrite() writes a snapshot of a list to a file. Only available on the host; on the
+ * board it always returns STANDARD_ERROR.
+ *
+ * @param list Any element in the list, or NULL for an empty snapshot.
+ * @param path The file to create or overwrite.
+ * @return SUCCESS or STANDARD_ERROR if the file couldn't be written.
+ */
+int ListSnapshotWrite(ListItem *list, const char *path);
+
+/**
+ * ListSnapshotView() sets up snapshot to read the snapshot stored in buffer. The header is checked,
+ * and so is the chain of links from the head, so that walking the snapshot always ends: that takes
+ * one pass over the records, but the strings aren't touched. buffer must stay valid (and
+ * unchanged) for as long as snapshot is used.
+ *
+ * @param snapshot The view to set up.
+ * @param buffer A snapshot written by ListSnapshotEncode(). Must be aligned for a uint32_t.
+ * @param size The size of buffer in bytes.
+ * @return SUCCESS, or STANDARD_ERROR if buffer doesn't hold a well-formed snapshot header or its
+ *         links don't form a single chain through every record.
+ */
+int ListSnapshotView(ListSnapshot *snapshot, const void *buffer, unsigned long size);
+
+/**
+ * ListSnapshotOpen() mmap()s a snapshot file written by ListSnapshotWrite() and sets up snapshot to
+ * read it. The records are checked as for ListSnapshotView(), but the strings are only loaded as
+ * they are used. Only available on the host; on the board it always returns STANDARD_ERROR.
+ *
+ * @param snapshot The view to set up.
+ * @param path The snapshot file.
+ * @return SUCCESS or STANDARD_ERROR if the file couldn't be mapped or isn't a snapshot.
+ */
+int ListSnapshotOpen(ListSnapshot *snapshot, const char *path);
+
+/**
+ * ListSnapshotClose() unmaps a snapshot opened with ListSnapshotOpen(). Does nothing for one set up
+ * with ListSnapshotView().
+ *
+ * @param snapshot The snapshot to close.
+ */
+void ListSnapshotClose(ListSnapshot *snapshot);
+
+/**
+ * ListSnapshotSize() returns the number of items in a snapshot, in constant time.
+ *
+ * @param snapshot An open snapshot.
+ * @return The number of items.
+ */
+int ListSnapshotSize(const ListSnapshot *snapshot);
+
+/**
+ * ListSnapshotFirst() returns the record index of the snapshot's head.
+ *
+ * @param snapshot An open snapshot.
+ * @return The index of the first item, or -1 if the snapshot is empty.
+ */
+int ListSnapshotFirst(const ListSnapshot *snapshot);
+
+/**
+ * ListSnapshotNext() returns the record index of the item after index.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The index of the next item, or -1 at the tail or if index is out of range.
+ */
+int ListSnapshotNext(const ListSnapshot *snapshot, int index);
+
+/**
+ * ListSnapshotPrevious() returns the record index of the item before index.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The index of the previous item, or -1 at the head or if index is out of range.
+ */
+int ListSnapshotPrevious(const ListSnapshot *snapshot, int index);
+
+/**
+ * ListSnapshotData() returns the string stored in an item, pointing straight into the snapshot.
+ *
+ * @param snapshot An open snapshot.
+ * @param index The index of an item in the snapshot.
+ * @return The item's string, or NULL if the item holds NULL or index is out of range.
+ */
+const char *ListSnapshotData(const ListSnapshot *snapshot, int index);
+
+/**
+ * ListSnapshotPrint() prints a snapshot the same way LinkedListPrint() prints a list.
+ *
+ * @param snapshot An open snapshot.
+ * @return SUCCESS or STANDARD_ERROR if passed a NULL pointer or an empty snapshot.
+ */
+int ListSnapshotPrint(const ListSnapshot *snapshot);
+
+/**
+ * ListSnapshotToList() builds a regular, modifiable list holding the same items as a snapshot.
+ * The ListItems are new, but their data still points into the snapshot, so the snapshot must stay
+ * open for as long as the list is used and the strings must not be written to.
+ *
+ * @param snapshot An open snapshot.
+ * @return The head of the new list, or NULL if the snapshot is empty or allocation failed.
+ */
+ListItem *ListSnapshotToList(const ListSnapshot *snapshot);
+
+#endif
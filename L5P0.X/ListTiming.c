@@ -0,0 +1,229 @@
+/*
+ * File:   ListTiming.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+//the board uses the core timer, the host uses clock_gettime()
+#ifdef __XC32
+#include <xc.h>
+#else
+#include <time.h>
+#endif
+
+#include "ListTiming.h"
+#include "BOARD.h"
+
+//without LINKEDLIST_TIMING nothing calls into this file, so leave the histograms (several KB of
+//RAM) out of the build altogether
+#ifdef LINKEDLIST_TIMING
+
+/*
+ * One histogram per operation, plus the exact maximum since buckets round it.
+ */
+typedef struct ListHistogram {
+    uint32_t buckets[LIST_TIMING_BUCKETS];
+    uint32_t samples;
+    uint64_t max;
+} ListHistogram;
+
+static ListHistogram histograms[LIST_OP_COUNT];
+
+static const char *operationNames[LIST_OP_COUNT] = {
+    "LinkedListNew",
+    "LinkedListRemove",
+    "LinkedListSize",
+    "LinkedListGetFirst",
+    "LinkedListGetAt",
+    "LinkedListCreateAfter",
+    "LinkedListCreateAfterN",
+    "LinkedListSwapData",
+    "LinkedListSort",
+    "LinkedListSortNatural",
+    "LinkedListSortAndCount",
+    "LinkedListPartitionNull",
+    "LinkedListPrint",
+    "LinkedListSplitAfter",
+    "LinkedListConcatenate",
+    "LinkedListSpliceAfter",
+    "LinkedListCompact",
+    "LinkedListCopyOnWrite",
+    "LinkedListMemoryUsage",
+    "UnsortedWordCount",
+    "SortedWordCount",
+    "SortedWordRuns",
+    "TopKWordCount",
+    "ShardedWordCount"
+};
+
+/*
+ * Maps a value to its bucket: values below LIST_TIMING_SUB_BUCKETS get a bucket each, after that
+ * each power of two gets LIST_TIMING_SUB_BUCKETS buckets chosen by the bits just below its top bit.
+ * Values of 2^LIST_TIMING_RANGE_BITS and up all go in the last bucket.
+ */
+static int ListTimingBucket(uint64_t value)
+{
+    int exponent = LIST_TIMING_RANGE_BITS - 1;
+    if (value < LIST_TIMING_SUB_BUCKETS) {
+        return value;
+    }
+    if (value >> LIST_TIMING_RANGE_BITS) {
+        return LIST_TIMING_BUCKETS - 1;
+    }
+    while (!(value & ((uint64_t) 1 << exponent))) {
+        exponent--;
+    }
+    return (exponent - LIST_TIMING_SUB_BUCKET_BITS + 1) * LIST_TIMING_SUB_BUCKETS
+            + ((value >> (exponent - LIST_TIMING_SUB_BUCKET_BITS)) & (LIST_TIMING_SUB_BUCKETS - 1));
+}
+
+/*
+ * The largest value that lands in a bucket.
+ */
+static uint64_t ListTimingBucketTop(int bucket)
+{
+    int shift;
+    if (bucket < LIST_TIMING_SUB_BUCKETS) {
+        return bucket;
+    }
+    if (bucket == LIST_TIMING_BUCKETS - 1) {
+        return UINT64_MAX;
+    }
+    shift = bucket / LIST_TIMING_SUB_BUCKETS - 1;
+    return (((uint64_t) (LIST_TIMING_SUB_BUCKETS + bucket % LIST_TIMING_SUB_BUCKETS)) << shift)
+            + (((uint64_t) 1 << shift) - 1);
+}
+
+/**
+ * ListTimingNow() reads the monotonic clock.
+ *
+ * @return The current time in nanoseconds, from an arbitrary starting point, so only differences
+ *         are meaningful. On the board the 32-bit core timer is extended to 64 bits here, which
+ *         only works if this is called at least once per wrap of the timer (every 107 s at 80 MHz).
+ */
+uint64_t ListTimingNow(void)
+{
+#ifdef __XC32
+    //the core timer ticks once every 2 system clocks; count its wraps to get the high 32 bits
+    static uint32_t lastCount = 0, wraps = 0;
+    uint32_t count = _CP0_GET_COUNT();
+    if (count < lastCount) {
+        wraps++;
+    }
+    lastCount = count;
+    return (((uint64_t) wraps << 32) | count) * (2000000000u / BOARD_GetSysClock());
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+/**
+ * ListTimingStart() starts timing one call. Used by LIST_TIMED_SCOPE().
+ *
+ * @param operation What is being timed.
+ * @return The running timer.
+ */
+ListTimer ListTimingStart(ListOperation operation)
+{
+    ListTimer timer;
+    timer.operation = operation;
+    timer.start = ListTimingNow();
+    return timer;
+}
+
+/**
+ * ListTimingStop() records the time since timer was started. Used by LIST_TIMED_SCOPE().
+ *
+ * @param timer A timer from ListTimingStart().
+ */
+void ListTimingStop(ListTimer *timer)
+{
+    ListTimingRecord(timer->operation, ListTimingNow() - timer->start);
+}
+
+/**
+ * ListTimingRecord() adds one sample to an operation's histogram.
+ *
+ * @param operation The operation the sample belongs to.
+ * @param nanoseconds How long the call took.
+ */
+void ListTimingRecord(ListOperation operation, uint64_t nanoseconds)
+{
+    ListHistogram *histogram;
+    if (operation < 0 || operation >= LIST_OP_COUNT) {
+        return;
+    }
+    histogram = &histograms[operation];
+    histogram->buckets[ListTimingBucket(nanoseconds)]++;
+    histogram->samples++;
+    if (nanoseconds > histogram->max) {
+        histogram->max = nanoseconds;
+    }
+}
+
+/**
+ * ListTimingPercentile() estimates a percentile of an operation's recorded latencies.
+ *
+ * @param operation The operation to look at.
+ * @param percentile Between 0 and 100, e.g. 99.9.
+ * @return The latency in nanoseconds (the top of the bucket the percentile falls in, capped at the
+ *         exact maximum), or 0 if nothing has been recorded.
+ */
+uint64_t ListTimingPercentile(ListOperation operation, double percentile)
+{
+    ListHistogram *histogram;
+    double wanted;
+    uint32_t seen = 0;
+    uint64_t top;
+    int i;
+    if (operation < 0 || operation >= LIST_OP_COUNT || histograms[operation].samples == 0) {
+        return 0;
+    }
+    histogram = &histograms[operation];
+    wanted = histogram->samples * percentile / 100.0;
+    for (i = 0; i < LIST_TIMING_BUCKETS; i++) {
+        seen += histogram->buckets[i];
+        if (seen > 0 && seen >= wanted) {
+            top = ListTimingBucketTop(i);
+            return (top < histogram->max) ? top : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+/**
+ * ListTimingPrint() prints the number of calls, p50, p99, p99.9 and max latency of every operation
+ * that has been called at least once.
+ */
+void ListTimingPrint(void)
+{
+    int i;
+    printf("%-24s %10s %10s %10s %10s %10s\n", "operation (ns)", "calls", "p50", "p99", "p99.9",
+            "max");
+    for (i = 0; i < LIST_OP_COUNT; i++) {
+        if (histograms[i].samples > 0) {
+            printf("%-24s %10lu %10llu %10llu %10llu %10llu\n", operationNames[i],
+                    (unsigned long) histograms[i].samples,
+                    (unsigned long long) ListTimingPercentile(i, 50.0),
+                    (unsigned long long) ListTimingPercentile(i, 99.0),
+                    (unsigned long long) ListTimingPercentile(i, 99.9),
+                    (unsigned long long) histograms[i].max);
+        }
+    }
+}
+
+/**
+ * ListTimingReset() clears every histogram.
+ */
+void ListTimingReset(void)
+{
+    memset(histograms, 0, sizeof (histograms));
+}
+
+#endif
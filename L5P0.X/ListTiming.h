@@ -0,0 +1,139 @@
+#ifndef LISTTIMING_H
+#define LISTTIMING_H
+
+#include <stdint.h>
+
+/**
+ * @file
+ * Optional per-call latency histograms for the list and word counting functions. Build with
+ * LINKEDLIST_TIMING defined to turn it on; otherwise LIST_TIMED_SCOPE() expands to nothing, the
+ * functions below aren't compiled in and none of this costs anything.
+ *
+ * Each timed function starts with LIST_TIMED_SCOPE(operation), which reads a monotonic clock and
+ * records the elapsed time into that operation's histogram when the function returns, whichever
+ * return it takes. Histograms are log-bucketed like HdrHistogram: every power of two is split into
+ * 2^LIST_TIMING_SUB_BUCKET_BITS buckets, so percentiles are accurate to within 1/2^bits of the
+ * value while each histogram stays a fixed size. Times are in nanoseconds, from clock_gettime()
+ * on the host and from the core timer on the board.
+ */
+
+// How finely each power of two is split. Each histogram takes about 4 * 2^bits * 38 bytes of RAM.
+#ifndef LIST_TIMING_SUB_BUCKET_BITS
+#define LIST_TIMING_SUB_BUCKET_BITS 3
+#endif
+
+// How many bits of nanoseconds the buckets cover, 2^40 ns being about 18 minutes. Anything longer
+// goes in the top bucket, though the exact maximum is still kept.
+#ifndef LIST_TIMING_RANGE_BITS
+#define LIST_TIMING_RANGE_BITS 40
+#endif
+
+#define LIST_TIMING_SUB_BUCKETS (1 << LIST_TIMING_SUB_BUCKET_BITS)
+#define LIST_TIMING_BUCKETS \
+    ((LIST_TIMING_RANGE_BITS + 1 - LIST_TIMING_SUB_BUCKET_BITS) * LIST_TIMING_SUB_BUCKETS)
+
+/**
+ * Every operation that can be timed. The cursor stepping functions and the allocation counter
+ * accessors are left out on purpose, as timing them would cost more than they do.
+ */
+typedef enum {
+    LIST_OP_NEW,
+    LIST_OP_REMOVE,
+    LIST_OP_SIZE,
+    LIST_OP_GET_FIRST,
+    LIST_OP_GET_AT,
+    LIST_OP_CREATE_AFTER,
+    LIST_OP_CREATE_AFTER_N,
+    LIST_OP_SWAP_DATA,
+    LIST_OP_SORT,
+    LIST_OP_SORT_NATURAL,
+    LIST_OP_SORT_AND_COUNT,
+    LIST_OP_PARTITION_NULL,
+    LIST_OP_PRINT,
+    LIST_OP_SPLIT_AFTER,
+    LIST_OP_CONCATENATE,
+    LIST_OP_SPLICE_AFTER,
+    LIST_OP_COMPACT,
+    LIST_OP_COPY_ON_WRITE,
+    LIST_OP_MEMORY_USAGE,
+    LIST_OP_UNSORTED_WORD_COUNT,
+    LIST_OP_SORTED_WORD_COUNT,
+    LIST_OP_SORTED_WORD_RUNS,
+    LIST_OP_TOP_K_WORD_COUNT,
+    LIST_OP_SHARDED_WORD_COUNT,
+    LIST_OP_COUNT
+} ListOperation;
+
+/**
+ * A running timer, made by LIST_TIMED_SCOPE().
+ */
+typedef struct ListTimer {
+    ListOperation operation;
+    uint64_t start;
+} ListTimer;
+
+#ifdef LINKEDLIST_TIMING
+/**
+ * Declares a timer that records how long the rest of the enclosing block takes under operation.
+ * Uses GCC's cleanup attribute (XC32 is GCC based) so that early returns are timed too.
+ */
+#define LIST_TIMED_SCOPE(operation) \
+    ListTimer listTimer __attribute__((cleanup(ListTimingStop), unused)) = ListTimingStart(operation)
+#else
+#define LIST_TIMED_SCOPE(operation)
+#endif
+
+/**
+ * ListTimingNow() reads the monotonic clock.
+ *
+ * @return The current time in nanoseconds, from an arbitrary starting point, so only differences
+ *         are meaningful. On the board the 32-bit core timer is extended to 64 bits here, which
+ *         only works if this is called at least once per wrap of the timer (every 107 s at 80 MHz).
+ */
+uint64_t ListTimingNow(void);
+
+/**
+ * ListTimingStart() starts timing one call. Used by LIST_TIMED_SCOPE().
+ *
+ * @param operation What is being timed.
+ * @return The running timer.
+ */
+ListTimer ListTimingStart(ListOperation operation);
+
+/**
+ * ListTimingStop() records the time since timer was started. Used by LIST_TIMED_SCOPE().
+ *
+ * @param timer A timer from ListTimingStart().
+ */
+void ListTimingStop(ListTimer *timer);
+
+/**
+ * ListTimingRecord() adds one sample to an operation's histogram.
+ *
+ * @param operation The operation the sample belongs to.
+ * @param nanoseconds How long the call took.
+ */
+void ListTimingRecord(ListOperation operation, uint64_t nanoseconds);
+
+/**
+ * ListTimingPercentile() estimates a percentile of an operation's recorded latencies.
+ *
+ * @param operation The operation to look at.
+ * @param percentile Between 0 and 100, e.g. 99.9.
+ * @return The latency in nanoseconds (the top of the bucket the percentile falls in, capped at the
+ *         exact maximum), or 0 if nothing has been recorded.
+ */
+uint64_t ListTimingPercentile(ListOperation operation, double percentile);
+
+/**
+ * ListTimingPrint() prints the number of calls, p50, p99, p99.9 and max latency of every operation
+ * that has been called at least once.
+ */
+void ListTimingPrint(void);
+
+/**
+ * ListTimingReset() clears every histogram.
+ */
+void ListTimingReset(void);
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * File:   ListTokenizer.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <string.h>
+
+#include "ListTokenizer.h"
+#include "BOARD.h"
+
+/*
+ * A chunk of bytes handled at once, as wide as the machine's registers.
+ */
+typedef unsigned long TokenChunk;
+
+#define TOKEN_CHUNK_BYTES sizeof (TokenChunk)
+
+//0x01 and 0x80 repeated in every byte of a chunk
+#define TOKEN_ONES (~(TokenChunk) 0 / 0xFF)
+#define TOKEN_HIGHS (TOKEN_ONES * 0x80)
+
+/*
+ * Returns a chunk with 0x80 in every byte of chunk that is an ASCII letter and 0 elsewhere. Folding
+ * in 0x20 turns uppercase into lowercase, so both cases are tested with one range check. The high
+ * bits are cleared first so that no byte can carry into the next one.
+ */
+static TokenChunk ListTokenizeLetters(TokenChunk chunk)
+{
+    TokenChunk folded = (chunk & ~TOKEN_HIGHS) | (TOKEN_ONES * 0x20);
+    TokenChunk atLeastA = (folded + TOKEN_ONES * (0x80 - 'a')) & TOKEN_HIGHS;
+    TokenChunk pastZ = (folded + TOKEN_ONES * (0x80 - 'z' - 1)) & TOKEN_HIGHS;
+    return atLeastA & ~pastZ & ~(chunk & TOKEN_HIGHS);
+}
+
+/*
+ * The index of the first byte of a chunk that has its high bit set in mask, which must not be 0.
+ */
+static int ListTokenizeFirstByte(TokenChunk mask)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return __builtin_ctzl(mask) / 8;
+#else
+    unsigned char bytes[TOKEN_CHUNK_BYTES];
+    int i = 0;
+    memcpy(bytes, &mask, TOKEN_CHUNK_BYTES);
+    while (bytes[i] == 0) {
+        i++;
+    }
+    return i;
+#endif
+}
+
+/*
+ * A mask of the high bits of bytes from index onwards.
+ */
+static TokenChunk ListTokenizeFrom(int index)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return TOKEN_HIGHS << (8 * index);
+#else
+    unsigned char bytes[TOKEN_CHUNK_BYTES];
+    TokenChunk mask;
+    memset(bytes, 0, index);
+    memset(bytes + index, 0x80, TOKEN_CHUNK_BYTES - index);
+    memcpy(&mask, bytes, TOKEN_CHUNK_BYTES);
+    return mask;
+#endif
+}
+
+/*
+ * ListWordCallback that appends a word after the ListItem that context points to.
+ */
+static int ListTokenizeAppend(char *word, void *context)
+{
+    ListItem **tail = context;
+    ListItem *item = LinkedListCreateAfter(*tail, word);
+    if (item == NULL) {
+        return STANDARD_ERROR;
+    }
+    *tail = item;
+    return SUCCESS;
+}
+
+/**
+ * ListTokenizeEach() splits buffer exactly like ListTokenize() but hands each word to a callback
+ * instead of building a list. Each word is already NUL-terminated (and folded) when the callback
+ * gets it, and no later part of the split writes to it again.
+ *
+ * @param buffer The text to split, changed in place as for ListTokenize().
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param callback Called once per word, in order. Returning STANDARD_ERROR stops the split.
+ * @param context Passed through to callback.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or callback stopped the split.
+ */
+int ListTokenizeEach(char *buffer, unsigned long length, int options, ListWordCallback callback,
+        void *context)
+{
+    unsigned long position, size;
+    char *word = NULL;
+    if (buffer == NULL || callback == NULL) {
+        return STANDARD_ERROR;
+    }
+    for (position = 0; position < length; position += TOKEN_CHUNK_BYTES) {
+        TokenChunk chunk = 0, letters, found;
+        int index = 0;
+        //the last partial chunk is padded with NULs, which are separators
+        size = (length - position < TOKEN_CHUNK_BYTES) ? length - position : TOKEN_CHUNK_BYTES;
+        memcpy(&chunk, buffer + position, size);
+        letters = ListTokenizeLetters(chunk);
+        if (options & LIST_TOKENIZE_FOLD_CASE) {
+            //0x80 shifted down 2 is the 0x20 that makes a letter lowercase
+            chunk |= letters >> 2;
+            memcpy(buffer + position, &chunk, size);
+        }
+
+        //alternate between finding the next word's start and its end until the chunk runs out
+        while (index < (int) size) {
+            if (word == NULL) {
+                found = letters & ListTokenizeFrom(index);
+                if (found == 0) {
+                    break;
+                }
+                index = ListTokenizeFirstByte(found);
+                word = buffer + position + index;
+            } else {
+                found = ~letters & TOKEN_HIGHS & ListTokenizeFrom(index);
+                if (found == 0) {
+                    break;
+                }
+                index = ListTokenizeFirstByte(found);
+                if (index >= (int) size) {
+                    break;
+                }
+                buffer[position + index] = '\0';
+                if (callback(word, context) == STANDARD_ERROR) {
+                    return STANDARD_ERROR;
+                }
+                word = NULL;
+            }
+            index++;
+        }
+    }
+    if (word != NULL) {
+        buffer[length] = '\0';
+        return callback(word, context);
+    }
+    return SUCCESS;
+}
+
+/**
+ * ListTokenize() appends every word in buffer to a list, in order.
+ *
+ * @param buffer The text to split. It is changed in place: separators after words become NULs and,
+ *               with LIST_TOKENIZE_FOLD_CASE, uppercase letters become lowercase. buffer[length]
+ *               must be writable too, since a word that runs to the end of the text is terminated
+ *               there; a NUL-terminated string can simply be passed with its strlen().
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param tail[in,out] The item to append the words after, or a pointer to NULL to start a new list.
+ *                     Updated to the last item added.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or malloc() failed (the words added
+ *         before the failure stay in the list).
+ */
+int ListTokenize(char *buffer, unsigned long length, int options, ListItem **tail)
+{
+    if (tail == NULL) {
+        return STANDARD_ERROR;
+    }
+    return ListTokenizeEach(buffer, length, options, ListTokenizeAppend, tail);
+}
@@ -0,0 +1,58 @@
+#ifndef LISTTOKENIZER_H
+#define LISTTOKENIZER_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * Splits raw text into a list of words, for counting with the functions in WordCount.c. A word is
+ * a run of ASCII letters (what isalpha() accepts in the "C" locale); everything else separates
+ * words. The words are not copied: each one is NUL-terminated in place, by overwriting the
+ * separator after it, and its ListItem points straight into the buffer, so the buffer must outlive
+ * the list. Letters can also be folded to lowercase in place on the way.
+ *
+ * Bytes are classified a whole machine word at a time (4 bytes on the board, 8 on a 64-bit host)
+ * with plain integer arithmetic, so no SIMD unit is needed, and folding a word's case is a single
+ * OR.
+ */
+
+// Options for ListTokenize().
+#define LIST_TOKENIZE_FOLD_CASE 0x01
+
+/**
+ * Called once per word by ListTokenizeEach(). Returning STANDARD_ERROR stops the split early.
+ */
+typedef int (*ListWordCallback)(char *word, void *context);
+
+/**
+ * ListTokenize() appends every word in buffer to a list, in order.
+ *
+ * @param buffer The text to split. It is changed in place: separators after words become NULs and,
+ *               with LIST_TOKENIZE_FOLD_CASE, uppercase letters become lowercase. buffer[length]
+ *               must be writable too, since a word that runs to the end of the text is terminated
+ *               there; a NUL-terminated string can simply be passed with its strlen().
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param tail[in,out] The item to append the words after, or a pointer to NULL to start a new list.
+ *                     Updated to the last item added.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or malloc() failed (the words added
+ *         before the failure stay in the list).
+ */
+int ListTokenize(char *buffer, unsigned long length, int options, ListItem **tail);
+
+/**
+ * ListTokenizeEach() splits buffer exactly like ListTokenize() but hands each word to a callback
+ * instead of building a list. Each word is already NUL-terminated (and folded) when the callback
+ * gets it, and no later part of the split writes to it again.
+ *
+ * @param buffer The text to split, changed in place as for ListTokenize().
+ * @param length How many bytes of text there are.
+ * @param options 0, or LIST_TOKENIZE_FOLD_CASE.
+ * @param callback Called once per word, in order. Returning STANDARD_ERROR stops the split.
+ * @param context Passed through to callback.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or callback stopped the split.
+ */
+int ListTokenizeEach(char *buffer, unsigned long length, int options, ListWordCallback callback,
+        void *context);
+
+#endif
@@ -0,0 +1,729 @@
+/*
+ * File:   WordCount.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+//threads are only available on the host, the board counts shards one after another
+#ifndef __XC32
+#include <pthread.h>
+#endif
+
+#include "WordCount.h"
+#include "ListTiming.h"
+#include "BOARD.h"
+
+/**
+ * One segment of the list being counted by ShardedWordCount(). After the merge, a word's count in
+ * table is 1 if this shard holds the first occurrence of the word in the whole list, and 0 if not.
+ */
+typedef struct WordShard {
+    ListItem *start;
+    int length;
+    int *wordCount; //this shard's part of the output
+    WordTable table;
+    WordTable *totals; //counts over the whole list, shared and read-only while labelling
+    int status;
+} WordShard;
+
+/**
+ * A bloom filter of the words UnsortedWordCount() has passed. bits is NULL when there is no filter.
+ */
+typedef struct WordBloom {
+    unsigned char *bits;
+    unsigned int mask; //number of bits - 1, always a power of 2 - 1
+} WordBloom;
+
+/**
+ * Where SortedWordRuns() is writing its output.
+ */
+typedef struct WordRunBuffer {
+    WordCountPair *runs;
+    int maxRuns;
+    int found;
+} WordRunBuffer;
+
+static void WordBloomInit(WordBloom *bloom, int items);
+static void WordBloomAdd(WordBloom *bloom, unsigned int hash);
+static int WordBloomMayContain(const WordBloom *bloom, unsigned int hash);
+
+/**
+ * This functions takes in the head of an unsorted list of words, and an array to store the number
+ * of occurrences of each word.  The first time a word appears, the number of occurrences of that
+ * word should be stored in the corresponding position in the array.  For repeated words the
+ * negative of the number of occurrences should be stored.  For example, a list of the following
+ * words should return an array with the following values:
+ *     {"hair", "comb", "brush", "brush"} -> {1, 1, 2, -2}
+ *
+ * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
+ * as regular strings that can have multiple occurrences, including the empty string, as the
+ * following output demonstrates.
+ *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
+ *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
+ *
+ * NOTE: This function assumes that wordCount is the same length as list.
+ * @param list A pointer to the head of a doubly-linked list containing unsorted words.
+ * @param wordCount An array of integers. The output of this function is stored here. It must be
+ *                  at least as big as the linked list pointed to be `list` is.
+ * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
+ */
+int UnsortedWordCount(ListItem *list, int *wordCount)
+{
+    LIST_TIMED_SCOPE(LIST_OP_UNSORTED_WORD_COUNT);
+    // Make sure the head of the list was given.
+    if (list->previousItem != NULL) {
+        return STANDARD_ERROR;
+    }
+
+    char *word1;
+    char *word2;
+    char *repCheck;
+    ListCursor cursor1, cursor2;
+    ListItem *item1;
+    ListItem *item2;
+    WordBloom bloom;
+    unsigned int hash;
+    int temp, firstOccurencePos;
+    int repetitionFlag = 0;
+    int i, j;
+
+    i = 0;
+    WordBloomInit(&bloom, LinkedListSize(list));
+    LinkedListCursorInit(&cursor1, list, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    while ((item1 = LinkedListCursorNext(&cursor1)) != NULL) {
+        // Count first occurrence
+        j = 1;
+        // Ignore NULL words
+        word1 = LINKEDLIST_DATA(item1);
+        if (word1 == NULL) {
+            wordCount[i++] = 0;
+            continue;
+        }
+
+        // Check previous occurrences, unless the filter says the word is definitely new
+        hash = WordHash(word1);
+        if (WordBloomMayContain(&bloom, hash)) {
+            temp = i;
+            LinkedListCursorInit(&cursor2, item1->previousItem, LIST_BACKWARD,
+                    LINKEDLIST_PREFETCH_DISTANCE);
+            while ((item2 = LinkedListCursorNext(&cursor2)) != NULL) {
+                --temp;
+                repCheck = LINKEDLIST_DATA(item2);
+                if (repCheck != NULL && strcmp(repCheck, word1) == 0) {
+                    repetitionFlag = 1;
+                    firstOccurencePos = temp;
+                }
+            }
+        }
+        WordBloomAdd(&bloom, hash);
+
+        // Count new occurrences
+        if (repetitionFlag == 0) {
+            LinkedListCursorInit(&cursor2, list, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+            while ((item2 = LinkedListCursorNext(&cursor2)) != NULL) {
+                word2 = LINKEDLIST_DATA(item2);
+                if (word2 != NULL && item1 != item2 && strcmp(word1, word2) == 0) {
+                    ++j;
+                }
+            }
+            wordCount[i++] = j;
+        } else {
+            wordCount[i++] = -wordCount[firstOccurencePos];
+            repetitionFlag = 0;
+        }
+    }
+    free(bloom.bits);
+    return SUCCESS;
+}
+
+/**
+ * ExpandWordRun() is a WordRunCallback (and a ListRunCallback) that expands a run back into the
+ * per-item format SortedWordCount() produces, the count at the first occurrence and its negative
+ * for every repeat (or 0s for NULLs), writing them at the cursor.
+ *
+ * @param word The run's word.
+ * @param count The length of the run.
+ * @param context A WordCountCursor.
+ * @return SUCCESS.
+ */
+int ExpandWordRun(char *word, int count, void *context)
+{
+    WordCountCursor *cursor = context;
+    int j;
+    for (j = 0; j < count; j++) {
+        if (word == NULL) {
+            cursor->wordCount[cursor->i++] = 0;
+        } else {
+            cursor->wordCount[cursor->i++] = (j == 0) ? count : -count;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * SortedWordCount() takes in the head of a sorted list of words arranged lexicographically, and an
+ * array to store the number of occurrences of each word.  The first time a word appears, the number
+ * of occurrences of that word should be stored in the corresponding position in the array.  For
+ * duplicate words a negative value of the number of occurrences should be stored.  For example, a
+ * list of the following words should return an array with the following values:
+ *     {"brush", "brush", "comb", "hair"} -> {2, -2, 1, 1}
+ *
+ * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
+ * as regular strings that can have multiple occurrences, including the empty string, as the
+ * following output demonstrates.
+ *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
+ *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
+ *
+ * NOTE: This function assumes that wordCount is the same length as list.
+ * @param list A pointer to the head of a doubly-linked list containing sorted words.
+ * @param wordCount An array of integers. The output of this function is stored here. It must be
+ *                  at least as big as the linked list pointed to be `list` is.
+ * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
+ */
+int SortedWordCount(ListItem *list, int *wordCount)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SORTED_WORD_COUNT);
+    WordCountCursor cursor;
+    if (wordCount == NULL) {
+        return STANDARD_ERROR;
+    }
+    cursor.wordCount = wordCount;
+    cursor.i = 0;
+    return SortedWordRunsForEach(list, ExpandWordRun, &cursor);
+}
+
+/**
+ * SortedWordRunsForEach() walks a sorted list once and calls callback for every run of equal
+ * adjacent words with the word and the length of the run, so the work done per distinct word is
+ * constant no matter how many duplicates there are. Words are compared by contents, not by
+ * pointer. A run of NULL items is reported with a NULL word and the number of NULL items, which
+ * callers that only care about real words can skip.
+ *     {NULL, NULL, "", "comb", "hair", "brush", "brush"} ->
+ *     (NULL, 2), ("", 1), ("comb", 1), ("hair", 1), ("brush", 2)
+ *
+ * @param list Any element in a sorted list.
+ * @param callback Called for each run, in list order.
+ * @param context Passed through to callback untouched.
+ * @return SUCCESS, STANDARD_ERROR if passed NULL pointers or if callback returned STANDARD_ERROR.
+ */
+int SortedWordRunsForEach(ListItem *list, WordRunCallback callback, void *context)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SORTED_WORD_RUNS);
+    ListCursor cursor;
+    char *word, *key;
+    int count;
+    if (list == NULL || callback == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    list = LinkedListCursorNext(&cursor);
+    while (list != NULL) {
+        //runs are found by reading the inline copies, but reported with the stored pointer
+        word = list->data;
+        key = LINKEDLIST_DATA(list);
+        count = 0;
+        do {
+            count++;
+            list = LinkedListCursorNext(&cursor);
+        } while (list != NULL && (LINKEDLIST_DATA(list) == key
+                || (list->data != NULL && key != NULL && strcmp(LINKEDLIST_DATA(list), key) == 0)));
+        if (callback(word, count, context) == STANDARD_ERROR) {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * WordRunCallback for SortedWordRuns(): stores runs while there is room, but keeps counting them.
+ */
+static int StoreWordRun(char *word, int count, void *context)
+{
+    WordRunBuffer *buffer = context;
+    if (buffer->found < buffer->maxRuns) {
+        buffer->runs[buffer->found].word = word;
+        buffer->runs[buffer->found].count = count;
+    }
+    buffer->found++;
+    return SUCCESS;
+}
+
+/**
+ * SortedWordRuns() stores the runs that SortedWordRunsForEach() finds into runs, so the output only
+ * needs one WordCountPair per distinct word (plus one for NULLs) instead of one int per list item.
+ *
+ * @param list Any element in a sorted list.
+ * @param runs Where to store the (word, count) runs.
+ * @param maxRuns How many WordCountPairs fit in runs.
+ * @param found[out] How many runs the list has. If this is more than maxRuns, only the first
+ *                   maxRuns were stored.
+ * @return SUCCESS, SIZE_ERROR if runs was too small or STANDARD_ERROR if passed NULL pointers.
+ */
+int SortedWordRuns(ListItem *list, WordCountPair *runs, int maxRuns, int *found)
+{
+    WordRunBuffer buffer;
+    if (runs == NULL || found == NULL) {
+        return STANDARD_ERROR;
+    }
+    buffer.runs = runs;
+    buffer.maxRuns = maxRuns;
+    buffer.found = 0;
+    if (SortedWordRunsForEach(list, StoreWordRun, &buffer) == STANDARD_ERROR) {
+        return STANDARD_ERROR;
+    }
+    *found = buffer.found;
+    return buffer.found > maxRuns ? SIZE_ERROR : SUCCESS;
+}
+
+/**
+ * WordHash() hashes the contents of a string (FNV-1a).
+ *
+ * @param word The string to hash. Must not be NULL.
+ * @return The hash.
+ */
+unsigned int WordHash(const char *word)
+{
+    unsigned int hash = 2166136261u;
+    while (*word) {
+        hash = (hash ^ (unsigned char) *word++) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Sets up an empty bloom filter with WORD_COUNT_BLOOM_BITS_PER_ITEM bits for each of items words,
+ * rounded up to a power of 2. If the filter is turned off or can't be allocated, bits is left NULL
+ * and the filter claims to contain every word, which only costs the time it was meant to save.
+ */
+static void WordBloomInit(WordBloom *bloom, int items)
+{
+    unsigned long bits = 8;
+    bloom->bits = NULL;
+    bloom->mask = 0;
+    if (WORD_COUNT_BLOOM_BITS_PER_ITEM <= 0 || items <= 0) {
+        return;
+    }
+    while (bits < (unsigned long) items * WORD_COUNT_BLOOM_BITS_PER_ITEM) {
+        bits *= 2;
+    }
+    bloom->bits = calloc(bits / 8, 1);
+    bloom->mask = bits - 1;
+}
+
+/*
+ * The 3 bits a word sets, from its hash and the hash rotated (double hashing).
+ */
+#define WORD_BLOOM_PROBES 3
+#define WORD_BLOOM_BIT(bloom, hash, probe) \
+    (((hash) + (probe) * (((hash) >> 17 | (hash) << 15) | 1)) & (bloom)->mask)
+
+/**
+ * Adds a word, by its WordHash(), to a bloom filter.
+ */
+static void WordBloomAdd(WordBloom *bloom, unsigned int hash)
+{
+    unsigned int probe, bit;
+    if (bloom->bits == NULL) {
+        return;
+    }
+    for (probe = 0; probe < WORD_BLOOM_PROBES; probe++) {
+        bit = WORD_BLOOM_BIT(bloom, hash, probe);
+        bloom->bits[bit / 8] |= 1 << (bit % 8);
+    }
+}
+
+/**
+ * Returns FALSE if the word with this WordHash() was certainly never added to the filter, TRUE if
+ * it might have been.
+ */
+static int WordBloomMayContain(const WordBloom *bloom, unsigned int hash)
+{
+    unsigned int probe, bit;
+    if (bloom->bits == NULL) {
+        return TRUE;
+    }
+    for (probe = 0; probe < WORD_BLOOM_PROBES; probe++) {
+        bit = WORD_BLOOM_BIT(bloom, hash, probe);
+        if (!(bloom->bits[bit / 8] & (1 << (bit % 8)))) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * WordTableInit() prepares an empty WordTable. The table grows by itself as words are added, so
+ * its memory stays proportional to the number of distinct words.
+ *
+ * @param table The table to initialize.
+ * @return SUCCESS, or STANDARD_ERROR if table is NULL or malloc() fails.
+ */
+int WordTableInit(WordTable *table)
+{
+    if (table == NULL) {
+        return STANDARD_ERROR;
+    }
+    table->capacity = 16;
+    table->used = 0;
+    table->slots = calloc(table->capacity, sizeof (WordCountPair));
+    if (table->slots == NULL) {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/**
+ * Finds the slot holding word, or the empty slot where it belongs.
+ */
+static WordCountPair *WordTableFind(const WordTable *table, const char *word)
+{
+    unsigned int mask = table->capacity - 1;
+    unsigned int i = WordHash(word) & mask;
+    while (table->slots[i].word != NULL && strcmp(table->slots[i].word, word) != 0) {
+        i = (i + 1) & mask;
+    }
+    return &table->slots[i];
+}
+
+/**
+ * WordTableAdd() adds count occurrences of word to the table, creating its entry if this is the
+ * first time it is seen. NULL words are ignored since they always count as 0.
+ *
+ * @param table The table to add to.
+ * @param word The word to count. Only the pointer is stored, not a copy of the string.
+ * @param count How many occurrences to add.
+ * @return SUCCESS, or STANDARD_ERROR if table is NULL or the table couldn't grow.
+ */
+int WordTableAdd(WordTable *table, char *word, int count)
+{
+    WordCountPair *slot;
+    if (table == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (word == NULL) {
+        return SUCCESS;
+    }
+    //keep the load factor under 1/2 so probes stay short
+    if ((table->used + 1) * 2 > table->capacity) {
+        WordTable bigger;
+        unsigned int i;
+        bigger.capacity = table->capacity * 2;
+        bigger.used = table->used;
+        bigger.slots = calloc(bigger.capacity, sizeof (WordCountPair));
+        if (bigger.slots == NULL) {
+            return STANDARD_ERROR;
+        }
+        for (i = 0; i < table->capacity; i++) {
+            if (table->slots[i].word != NULL) {
+                *WordTableFind(&bigger, table->slots[i].word) = table->slots[i];
+            }
+        }
+        free(table->slots);
+        *table = bigger;
+    }
+    slot = WordTableFind(table, word);
+    if (slot->word == NULL) {
+        slot->word = word;
+        slot->count = 0;
+        table->used++;
+    }
+    slot->count += count;
+    return SUCCESS;
+}
+
+/**
+ * WordTableLookup() finds a word's entry in the table. The entry stays valid until the next
+ * WordTableAdd() of a new word, which may move every entry.
+ *
+ * @param table The table to search.
+ * @param word The word to look for.
+ * @return The word's entry, or NULL if it isn't in the table (or word is NULL).
+ */
+WordCountPair *WordTableLookup(const WordTable *table, const char *word)
+{
+    WordCountPair *slot;
+    if (table == NULL || word == NULL) {
+        return NULL;
+    }
+    slot = WordTableFind(table, word);
+    return (slot->word != NULL) ? slot : NULL;
+}
+
+/**
+ * WordTableFree() releases the table's slots. The words themselves are not freed.
+ *
+ * @param table The table to free.
+ */
+void WordTableFree(WordTable *table)
+{
+    if (table != NULL) {
+        free(table->slots);
+        table->slots = NULL;
+        table->capacity = 0;
+        table->used = 0;
+    }
+}
+
+/**
+ * Returns nonzero if a should be ranked below b: fewer occurrences, or the same number of
+ * occurrences and alphabetically later.
+ */
+static int WordRanksBelow(const WordCountPair *a, const WordCountPair *b)
+{
+    if (a->count != b->count) {
+        return a->count < b->count;
+    }
+    return strcmp(a->word, b->word) > 0;
+}
+
+/**
+ * Restores the min-heap property (lowest ranked word at the root) below position i.
+ */
+static void WordHeapSiftDown(WordCountPair *heap, int size, int i)
+{
+    WordCountPair temp;
+    int child;
+    while ((child = 2 * i + 1) < size) {
+        if (child + 1 < size && WordRanksBelow(&heap[child + 1], &heap[child])) {
+            child++;
+        }
+        if (!WordRanksBelow(&heap[child], &heap[i])) {
+            break;
+        }
+        temp = heap[i];
+        heap[i] = heap[child];
+        heap[child] = temp;
+        i = child;
+    }
+}
+
+/**
+ * TopKWordCount() finds the k most frequent words in a list, whether or not the list is sorted.
+ * Words are counted into a WordTable and the best k are kept in a bounded min-heap that lives in
+ * topWords itself, so memory use is O(k + distinct words) and time is O(n log k). NULL data is not
+ * a word and is never reported. Results are stored in descending order of count, with ties broken
+ * alphabetically. For example, the list {"brush", NULL, "comb", "brush", "hair", "comb", "brush"}
+ * with k = 2 gives {{"brush", 3}, {"comb", 2}}.
+ *
+ * @param list Any element in the list to count.
+ * @param k The maximum number of words to report.
+ * @param topWords An array of at least k WordCountPairs where the results are stored.
+ * @param found[out] How many pairs were stored in topWords (less than k if the list has fewer
+ *                   distinct words).
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers, a negative k or malloc() fails.
+ */
+int TopKWordCount(ListItem *list, int k, WordCountPair *topWords, int *found)
+{
+    LIST_TIMED_SCOPE(LIST_OP_TOP_K_WORD_COUNT);
+    ListCursor cursor;
+    WordTable table;
+    WordCountPair temp;
+    unsigned int i;
+    int size = 0;
+    if (list == NULL || topWords == NULL || found == NULL || k < 0) {
+        return STANDARD_ERROR;
+    }
+    if (WordTableInit(&table) == STANDARD_ERROR) {
+        return STANDARD_ERROR;
+    }
+    LinkedListCursorInit(&cursor, LinkedListGetFirst(list), LIST_FORWARD,
+            LINKEDLIST_PREFETCH_DISTANCE);
+    while ((list = LinkedListCursorNext(&cursor)) != NULL) {
+        if (WordTableAdd(&table, list->data, 1) == STANDARD_ERROR) {
+            WordTableFree(&table);
+            return STANDARD_ERROR;
+        }
+    }
+
+    //keep the k best words seen so far, with the worst of them at the root
+    for (i = 0; i < table.capacity && k > 0; i++) {
+        if (table.slots[i].word == NULL) {
+            continue;
+        }
+        if (size < k) {
+            int child = size++;
+            topWords[child] = table.slots[i];
+            while (child > 0 && WordRanksBelow(&topWords[child], &topWords[(child - 1) / 2])) {
+                temp = topWords[child];
+                topWords[child] = topWords[(child - 1) / 2];
+                topWords[(child - 1) / 2] = temp;
+                child = (child - 1) / 2;
+            }
+        } else if (WordRanksBelow(&topWords[0], &table.slots[i])) {
+            topWords[0] = table.slots[i];
+            WordHeapSiftDown(topWords, size, 0);
+        }
+    }
+    WordTableFree(&table);
+
+    //pop the worst word to the back each time, which leaves the array in descending order
+    *found = size;
+    while (size > 1) {
+        temp = topWords[0];
+        topWords[0] = topWords[--size];
+        topWords[size] = temp;
+        WordHeapSiftDown(topWords, size, 0);
+    }
+    return SUCCESS;
+}
+
+/**
+ * First phase of ShardedWordCount(): count one shard's words into its own table.
+ */
+static void *CountWordShard(void *context)
+{
+    WordShard *shard = context;
+    ListCursor cursor;
+    ListItem *item;
+    int i;
+    shard->status = WordTableInit(&shard->table);
+    LinkedListCursorInit(&cursor, shard->start, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    for (i = 0; i < shard->length && shard->status == SUCCESS; i++) {
+        item = LinkedListCursorNext(&cursor);
+        shard->status = WordTableAdd(&shard->table, LINKEDLIST_DATA(item), 1);
+    }
+    return NULL;
+}
+
+/**
+ * Last phase of ShardedWordCount(): write one shard's part of wordCount. Only this shard's own
+ * table is written to, so shards can do this at the same time.
+ */
+static void *LabelWordShard(void *context)
+{
+    WordShard *shard = context;
+    WordCountPair *local;
+    ListCursor cursor;
+    ListItem *item;
+    int i, total;
+    LinkedListCursorInit(&cursor, shard->start, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    for (i = 0; i < shard->length; i++) {
+        item = LinkedListCursorNext(&cursor);
+        if (item->data == NULL) {
+            shard->wordCount[i] = 0;
+            continue;
+        }
+        total = WordTableLookup(shard->totals, LINKEDLIST_DATA(item))->count;
+        local = WordTableLookup(&shard->table, LINKEDLIST_DATA(item));
+        if (local->count == 1) {
+            shard->wordCount[i] = total;
+            local->count = 0;
+        } else {
+            shard->wordCount[i] = -total;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Runs phase on every shard, on its own thread where threads are available.
+ */
+static void RunWordShards(WordShard *shards, int count, void *(*phase)(void *))
+{
+    int i;
+#ifndef __XC32
+    pthread_t threads[WORD_COUNT_MAX_SHARDS];
+    int started[WORD_COUNT_MAX_SHARDS];
+    for (i = 0; i < count; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, phase, &shards[i]) == 0);
+        if (!started[i]) {
+            phase(&shards[i]);
+        }
+    }
+    for (i = 0; i < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+#else
+    for (i = 0; i < count; i++) {
+        phase(&shards[i]);
+    }
+#endif
+}
+
+/**
+ * ShardedWordCount() produces exactly the same wordCount output as UnsortedWordCount() (the count
+ * at a word's first occurrence, its negative at every repeat and 0 for NULLs) but in linear time,
+ * and on several threads on the host. The list is split into shards of consecutive items and each
+ * shard is counted into its own WordTable in parallel. The shard tables are then merged in list
+ * order into one table of totals, which also tells each shard which words it saw first. Finally,
+ * every shard writes its part of wordCount in parallel. On the board the shards simply run one
+ * after another.
+ *
+ * @param list Any element in the list to count.
+ * @param wordCount An array of integers at least as big as the list, where the output is stored.
+ * @param shards How many pieces to split the list into, at most WORD_COUNT_MAX_SHARDS.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers, a bad shard count or malloc() fails.
+ */
+int ShardedWordCount(ListItem *list, int *wordCount, int shards)
+{
+    LIST_TIMED_SCOPE(LIST_OP_SHARDED_WORD_COUNT);
+    WordShard shard[WORD_COUNT_MAX_SHARDS];
+    WordTable totals;
+    WordCountPair *slot, *total;
+    ListCursor cursor;
+    unsigned int j;
+    int size, i, k, offset = 0, status = SUCCESS;
+    if (list == NULL || wordCount == NULL || shards < 1 || shards > WORD_COUNT_MAX_SHARDS) {
+        return STANDARD_ERROR;
+    }
+    list = LinkedListGetFirst(list);
+    size = LinkedListSize(list);
+    if (shards > size) {
+        shards = size;
+    }
+
+    //cut the list into shards of nearly equal length
+    LinkedListCursorInit(&cursor, list, LIST_FORWARD, LINKEDLIST_PREFETCH_DISTANCE);
+    for (i = 0; i < shards; i++) {
+        shard[i].length = size / shards + (i < size % shards);
+        shard[i].start = cursor.current;
+        shard[i].wordCount = wordCount + offset;
+        shard[i].totals = &totals;
+        offset += shard[i].length;
+        for (k = 0; k < shard[i].length; k++) {
+            LinkedListCursorNext(&cursor);
+        }
+    }
+
+    RunWordShards(shard, shards, CountWordShard);
+
+    //merge in list order, so the first shard to add a word is the one holding its first occurrence
+    if (WordTableInit(&totals) == STANDARD_ERROR) {
+        status = STANDARD_ERROR;
+    }
+    for (i = 0; i < shards; i++) {
+        if (shard[i].status == STANDARD_ERROR) {
+            status = STANDARD_ERROR;
+        }
+        for (j = 0; status == SUCCESS && j < shard[i].table.capacity; j++) {
+            slot = &shard[i].table.slots[j];
+            if (slot->word == NULL) {
+                continue;
+            }
+            total = WordTableLookup(&totals, slot->word);
+            if (total == NULL) {
+                status = WordTableAdd(&totals, slot->word, slot->count);
+                slot->count = 1;
+            } else {
+                total->count += slot->count;
+                slot->count = 0;
+            }
+        }
+    }
+
+    if (status == SUCCESS) {
+        RunWordShards(shard, shards, LabelWordShard);
+    }
+    for (i = 0; i < shards; i++) {
+        WordTableFree(&shard[i].table);
+    }
+    WordTableFree(&totals);
+    return status;
+}
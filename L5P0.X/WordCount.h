@@ -0,0 +1,221 @@
+#ifndef WORDCOUNT_H
+#define WORDCOUNT_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * Counting the words in a list. UnsortedWordCount(), SortedWordCount() and ShardedWordCount() fill
+ * in one int per list item (a word's count at its first occurrence, the negative of its count at
+ * every repeat and 0 for NULLs), SortedWordRuns() and SortedWordRunsForEach() report one
+ * (word, count) pair per run of a sorted list, and TopKWordCount() finds the most frequent words.
+ *
+ * WordTable, the hash table most of these count into, and WordHash() are also used by other
+ * modules that need to look words up by their contents.
+ */
+
+// The most shards ShardedWordCount() will split a list into.
+#define WORD_COUNT_MAX_SHARDS 16
+
+// Bloom filter bits UnsortedWordCount() spends per list item to recognize words it certainly hasn't
+// seen yet, about a 3% false positive rate at 8. 0 turns the filter off.
+#ifndef WORD_COUNT_BLOOM_BITS_PER_ITEM
+#define WORD_COUNT_BLOOM_BITS_PER_ITEM 8
+#endif
+
+/**
+ * A distinct word and how many times it occurs in a list.
+ */
+typedef struct WordCountPair {
+    char *word;
+    int count;
+} WordCountPair;
+
+/**
+ * Open-addressed hash table of WordCountPairs keyed by string contents. Empty slots have a NULL
+ * word, which is fine since NULL list data is never counted.
+ */
+typedef struct WordTable {
+    WordCountPair *slots;
+    unsigned int capacity; //always a power of 2
+    unsigned int used;
+} WordTable;
+
+/**
+ * Called once per run of equal words by SortedWordRunsForEach(). Returning STANDARD_ERROR stops
+ * the walk early.
+ */
+typedef int (*WordRunCallback)(char *word, int count, void *context);
+
+/**
+ * Where ExpandWordRun() is in its wordCount array. Start i at 0.
+ */
+typedef struct WordCountCursor {
+    int *wordCount;
+    int i;
+} WordCountCursor;
+
+/**
+ * This functions takes in the head of an unsorted list of words, and an array to store the number
+ * of occurrences of each word.  The first time a word appears, the number of occurrences of that
+ * word should be stored in the corresponding position in the array.  For repeated words the
+ * negative of the number of occurrences should be stored.  For example, a list of the following
+ * words should return an array with the following values:
+ *     {"hair", "comb", "brush", "brush"} -> {1, 1, 2, -2}
+ *
+ * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
+ * as regular strings that can have multiple occurrences, including the empty string, as the
+ * following output demonstrates.
+ *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
+ *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
+ *
+ * NOTE: This function assumes that wordCount is the same length as list.
+ * @param list A pointer to the head of a doubly-linked list containing unsorted words.
+ * @param wordCount An array of integers. The output of this function is stored here. It must be
+ *                  at least as big as the linked list pointed to be `list` is.
+ * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
+ */
+int UnsortedWordCount(ListItem *list, int *wordCount);
+
+/**
+ * SortedWordCount() takes in the head of a sorted list of words arranged lexicographically, and an
+ * array to store the number of occurrences of each word.  The first time a word appears, the number
+ * of occurrences of that word should be stored in the corresponding position in the array.  For
+ * duplicate words a negative value of the number of occurrences should be stored.  For example, a
+ * list of the following words should return an array with the following values:
+ *     {"brush", "brush", "comb", "hair"} -> {2, -2, 1, 1}
+ *
+ * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
+ * as regular strings that can have multiple occurrences, including the empty string, as the
+ * following output demonstrates.
+ *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
+ *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
+ *
+ * NOTE: This function assumes that wordCount is the same length as list.
+ * @param list A pointer to the head of a doubly-linked list containing sorted words.
+ * @param wordCount An array of integers. The output of this function is stored here. It must be
+ *                  at least as big as the linked list pointed to be `list` is.
+ * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
+ */
+int SortedWordCount(ListItem *list, int *wordCount);
+
+/**
+ * ExpandWordRun() is a WordRunCallback (and a ListRunCallback) that expands a run back into the
+ * per-item format SortedWordCount() produces, the count at the first occurrence and its negative
+ * for every repeat (or 0s for NULLs), writing them at the cursor.
+ *
+ * @param word The run's word.
+ * @param count The length of the run.
+ * @param context A WordCountCursor.
+ * @return SUCCESS.
+ */
+int ExpandWordRun(char *word, int count, void *context);
+
+/**
+ * SortedWordRunsForEach() walks a sorted list once and calls callback for every run of equal
+ * adjacent words with the word and the length of the run, so the work done per distinct word is
+ * constant no matter how many duplicates there are. Words are compared by contents, not by
+ * pointer. A run of NULL items is reported with a NULL word and the number of NULL items, which
+ * callers that only care about real words can skip.
+ *     {NULL, NULL, "", "comb", "hair", "brush", "brush"} ->
+ *     (NULL, 2), ("", 1), ("comb", 1), ("hair", 1), ("brush", 2)
+ *
+ * @param list Any element in a sorted list.
+ * @param callback Called for each run, in list order.
+ * @param context Passed through to callback untouched.
+ * @return SUCCESS, STANDARD_ERROR if passed NULL pointers or if callback returned STANDARD_ERROR.
+ */
+int SortedWordRunsForEach(ListItem *list, WordRunCallback callback, void *context);
+
+/**
+ * SortedWordRuns() stores the runs that SortedWordRunsForEach() finds into runs, so the output only
+ * needs one WordCountPair per distinct word (plus one for NULLs) instead of one int per list item.
+ *
+ * @param list Any element in a sorted list.
+ * @param runs Where to store the (word, count) runs.
+ * @param maxRuns How many WordCountPairs fit in runs.
+ * @param found[out] How many runs the list has. If this is more than maxRuns, only the first
+ *                   maxRuns were stored.
+ * @return SUCCESS, SIZE_ERROR if runs was too small or STANDARD_ERROR if passed NULL pointers.
+ */
+int SortedWordRuns(ListItem *list, WordCountPair *runs, int maxRuns, int *found);
+
+/**
+ * TopKWordCount() finds the k most frequent words in a list, whether or not the list is sorted.
+ * Words are counted into a WordTable and the best k are kept in a bounded min-heap that lives in
+ * topWords itself, so memory use is O(k + distinct words) and time is O(n log k). NULL data is not
+ * a word and is never reported. Results are stored in descending order of count, with ties broken
+ * alphabetically. For example, the list {"brush", NULL, "comb", "brush", "hair", "comb", "brush"}
+ * with k = 2 gives {{"brush", 3}, {"comb", 2}}.
+ *
+ * @param list Any element in the list to count.
+ * @param k The maximum number of words to report.
+ * @param topWords An array of at least k WordCountPairs where the results are stored.
+ * @param found[out] How many pairs were stored in topWords (less than k if the list has fewer
+ *                   distinct words).
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers, a negative k or malloc() fails.
+ */
+int TopKWordCount(ListItem *list, int k, WordCountPair *topWords, int *found);
+
+/**
+ * ShardedWordCount() produces exactly the same wordCount output as UnsortedWordCount() (the count
+ * at a word's first occurrence, its negative at every repeat and 0 for NULLs) but in linear time,
+ * and on several threads on the host. The list is split into shards of consecutive items and each
+ * shard is counted into its own WordTable in parallel. The shard tables are then merged in list
+ * order into one table of totals, which also tells each shard which words it saw first. Finally,
+ * every shard writes its part of wordCount in parallel. On the board the shards simply run one
+ * after another.
+ *
+ * @param list Any element in the list to count.
+ * @param wordCount An array of integers at least as big as the list, where the output is stored.
+ * @param shards How many pieces to split the list into, at most WORD_COUNT_MAX_SHARDS.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers, a bad shard count or malloc() fails.
+ */
+int ShardedWordCount(ListItem *list, int *wordCount, int shards);
+
+/**
+ * WordHash() hashes the contents of a string (FNV-1a).
+ *
+ * @param word The string to hash. Must not be NULL.
+ * @return The hash.
+ */
+unsigned int WordHash(const char *word);
+
+/**
+ * WordTableInit() prepares an empty WordTable. The table grows by itself as words are added, so
+ * its memory stays proportional to the number of distinct words.
+ *
+ * @param table The table to initialize.
+ * @return SUCCESS, or STANDARD_ERROR if table is NULL or malloc() fails.
+ */
+int WordTableInit(WordTable *table);
+
+/**
+ * WordTableAdd() adds count occurrences of word to the table, creating its entry if this is the
+ * first time it is seen. NULL words are ignored since they always count as 0.
+ *
+ * @param table The table to add to.
+ * @param word The word to count. Only the pointer is stored, not a copy of the string.
+ * @param count How many occurrences to add.
+ * @return SUCCESS, or STANDARD_ERROR if table is NULL or the table couldn't grow.
+ */
+int WordTableAdd(WordTable *table, char *word, int count);
+
+/**
+ * WordTableLookup() finds a word's entry in the table. The entry stays valid until the next
+ * WordTableAdd() of a new word, which may move every entry.
+ *
+ * @param table The table to search.
+ * @param word The word to look for.
+ * @return The word's entry, or NULL if it isn't in the table (or word is NULL).
+ */
+WordCountPair *WordTableLookup(const WordTable *table, const char *word);
+
+/**
+ * WordTableFree() releases the table's slots. The words themselves are not freed.
+ *
+ * @param table The table to free.
+ */
+void WordTableFree(WordTable *table);
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * File:   ArenaBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: builds a list that owns copies of its words, once with a strdup() per word and once
+ * with a ListArena, and reports build and teardown time, heap per word and malloc() calls. Heap use
+ * comes from glibc's mallinfo2().
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/ArenaBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListArena.c ListTiming.c -pthread -o arena
+ *     ./arena [list size, default 1000000] [chunk size, default 65536]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListArena.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define MAX_WORD_LENGTH 12
+#define REPEATS 3
+
+// **** Declare any data types here ****
+/*
+ * What one build and teardown cost.
+ */
+typedef struct ArenaResult {
+    double build;
+    double teardown;
+    double heapPerWord;
+    double stringHeapPerWord;
+    unsigned long mallocs;
+} ArenaResult;
+
+// **** Declare any function prototypes here ****
+static void Run(char (*source)[MAX_WORD_LENGTH + 1], int count, unsigned long chunkSize,
+        ArenaResult *result);
+static void PrintResult(const char *name, const ArenaResult *result);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, i;
+    unsigned long chunkSize = (argc > 2) ? strtoul(argv[2], NULL, 10) : 65536;
+    char (*source)[MAX_WORD_LENGTH + 1] = malloc(count * sizeof (*source));
+    ArenaResult strdupResult, arenaResult;
+    char arenaName[40];
+
+    if (source == NULL || count < 1) {
+        printf("Couldn't set up %d words\n", count);
+        return 1;
+    }
+    //the words to copy sit in one flat buffer, standing in for a file being read
+    for (i = 0; i < count; i++) {
+        char *word = BenchmarkRandomWord(3, MAX_WORD_LENGTH);
+        strcpy(source[i], word);
+        free(word);
+    }
+
+    Run(source, count, 0, &strdupResult);
+    Run(source, count, chunkSize, &arenaResult);
+    printf("%d words of 3-%d letters, best of %d\n", count, MAX_WORD_LENGTH, REPEATS);
+    PrintResult("strdup() per word", &strdupResult);
+    snprintf(arenaName, sizeof (arenaName), "arena, %lu byte chunks", chunkSize);
+    PrintResult(arenaName, &arenaResult);
+
+    free(source);
+    return 0;
+}
+
+/*
+ * Builds and tears down a list of copies of the source words REPEATS times, with a ListArena of
+ * the given chunk size, or with strdup() if chunkSize is 0.
+ */
+static void Run(char (*source)[MAX_WORD_LENGTH + 1], int count, unsigned long chunkSize,
+        ArenaResult *result)
+{
+    ListArena arena;
+    ListArenaChunk *chunk;
+    ListItem *tail, *previous;
+    double start, elapsed;
+    size_t heapBefore;
+    int i, repeat;
+
+    result->build = result->teardown = 1e9;
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        heapBefore = mallinfo2().uordblks;
+        LinkedListResetAllocationCount();
+        ListArenaInit(&arena, (chunkSize > 0) ? chunkSize : 1);
+        tail = NULL;
+        start = BenchmarkNow();
+        for (i = 0; i < count; i++) {
+            if (chunkSize > 0) {
+                tail = ListArenaCreateAfter(&arena, tail, source[i]);
+            } else {
+                tail = LinkedListCreateAfter(tail, strdup(source[i]));
+            }
+        }
+        elapsed = BenchmarkNow() - start;
+        result->build = (elapsed < result->build) ? elapsed : result->build;
+
+        result->heapPerWord = (double) (mallinfo2().uordblks - heapBefore) / count;
+        result->stringHeapPerWord = result->heapPerWord - (double) LinkedListHeapInUse() / count;
+        result->mallocs = LinkedListAllocationCount();
+        if (chunkSize > 0) {
+            for (chunk = arena.chunks; chunk != NULL; chunk = chunk->next) {
+                result->mallocs++;
+            }
+        } else {
+            result->mallocs += count;
+        }
+
+        start = BenchmarkNow();
+        while (tail != NULL) {
+            previous = tail->previousItem;
+            if (chunkSize > 0) {
+                LinkedListRemove(tail);
+            } else {
+                free(LinkedListRemove(tail));
+            }
+            tail = previous;
+        }
+        ListArenaFree(&arena);
+        elapsed = BenchmarkNow() - start;
+        result->teardown = (elapsed < result->teardown) ? elapsed : result->teardown;
+    }
+}
+
+/*
+ * Prints one result.
+ */
+static void PrintResult(const char *name, const ArenaResult *result)
+{
+    printf("%s:\n", name);
+    printf("  build %.1f ms, teardown %.1f ms\n", result->build * 1e3, result->teardown * 1e3);
+    printf("  %.1f B of heap per word, %.1f B of it for the string\n", result->heapPerWord,
+            result->stringHeapPerWord);
+    printf("  %lu malloc() calls\n", result->mallocs);
+}
@@ -0,0 +1,282 @@
+/*
+ * File:   BenchmarkSupport.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "BenchmarkSupport.h"
+#include "BOARD.h"
+
+// The most bytes BenchmarkScatteredList() puts between two items.
+#define SCATTER_GAP 256
+
+// How many distinct words BenchmarkText() draws from.
+#define TEXT_VOCABULARY_SIZE 20000
+
+static unsigned long randomState = 2463534242UL;
+
+/**
+ * BenchmarkNow() reads a monotonic clock.
+ *
+ * @return The time in seconds.
+ */
+double BenchmarkNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * BenchmarkSeed() restarts the random number generator, so a benchmark can make the same input
+ * again.
+ *
+ * @param seed Any nonzero number.
+ */
+void BenchmarkSeed(unsigned long seed)
+{
+    randomState = seed & 0xFFFFFFFFUL;
+}
+
+/**
+ * BenchmarkRandom() returns the next number from a 32-bit xorshift generator.
+ *
+ * @return A number from 0 to 0xFFFFFFFF.
+ */
+unsigned long BenchmarkRandom(void)
+{
+    randomState ^= (randomState << 13) & 0xFFFFFFFFUL;
+    randomState ^= randomState >> 17;
+    randomState ^= (randomState << 5) & 0xFFFFFFFFUL;
+    return randomState;
+}
+
+/**
+ * BenchmarkRandomWord() makes a random lowercase word.
+ *
+ * @param minLength The shortest word to make.
+ * @param maxLength The longest word to make.
+ * @return A malloc()ed word, or NULL if malloc() fails.
+ */
+char *BenchmarkRandomWord(int minLength, int maxLength)
+{
+    int length = minLength + BenchmarkRandom() % (maxLength - minLength + 1), i;
+    char *word = malloc(length + 1);
+    if (word == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < length; i++) {
+        word[i] = 'a' + BenchmarkRandom() % 26;
+    }
+    word[length] = '\0';
+    return word;
+}
+
+/**
+ * BenchmarkVocabulary() makes an array of size random words with BenchmarkRandomWord(). Words may
+ * repeat, which only matters for very small vocabularies.
+ *
+ * @param size How many words to make.
+ * @param minLength The shortest word to make.
+ * @param maxLength The longest word to make.
+ * @return The words, or NULL if malloc() fails. Free them with BenchmarkFreeWords().
+ */
+char **BenchmarkVocabulary(int size, int minLength, int maxLength)
+{
+    char **words = malloc(size * sizeof (char *));
+    int i;
+    if (words == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < size; i++) {
+        words[i] = BenchmarkRandomWord(minLength, maxLength);
+        if (words[i] == NULL) {
+            BenchmarkFreeWords(words, i);
+            return NULL;
+        }
+    }
+    return words;
+}
+
+/**
+ * BenchmarkFreeWords() frees every word in an array from BenchmarkVocabulary() and the array
+ * itself. NULL words are skipped.
+ *
+ * @param words The array to free.
+ * @param count How many words it holds.
+ */
+void BenchmarkFreeWords(char **words, int count)
+{
+    int i;
+    if (words == NULL) {
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        free(words[i]);
+    }
+    free(words);
+}
+
+/**
+ * BenchmarkZipfTable() builds the cumulative weights BenchmarkZipf() picks from, giving rank r a
+ * weight of 1 / r (Zipf's law with s = 1).
+ *
+ * @param size How many ranks there are.
+ * @return The malloc()ed table, or NULL if malloc() fails.
+ */
+double *BenchmarkZipfTable(int size)
+{
+    double *table = malloc(size * sizeof (double)), total = 0;
+    int i;
+    if (table == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < size; i++) {
+        total += 1.0 / (i + 1);
+        table[i] = total;
+    }
+    return table;
+}
+
+/**
+ * BenchmarkZipf() picks a Zipf-distributed rank, so index 0 is the most likely.
+ *
+ * @param table A table from BenchmarkZipfTable().
+ * @param size The size table was built with.
+ * @return An index from 0 to size - 1.
+ */
+int BenchmarkZipf(const double *table, int size)
+{
+    double pick = BenchmarkRandom() / 4294967296.0 * table[size - 1];
+    int low = 0, high = size - 1;
+    //binary search for the first rank whose cumulative weight passes the pick
+    while (low < high) {
+        int middle = (low + high) / 2;
+        if (table[middle] <= pick) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * BenchmarkText() fills a buffer with English-like text: Zipf-distributed words of 1 to 9 letters
+ * from a fixed vocabulary, one in ten capitalized, separated mostly by spaces with some
+ * punctuation and line breaks.
+ *
+ * @param text Where to put the text. Must hold length + 1 bytes, as the text is NUL-terminated.
+ * @param length How many bytes of text to make.
+ * @return SUCCESS, or STANDARD_ERROR if malloc() fails.
+ */
+int BenchmarkText(char *text, unsigned long length)
+{
+    char **vocabulary = BenchmarkVocabulary(TEXT_VOCABULARY_SIZE, 1, 9);
+    double *zipf = BenchmarkZipfTable(TEXT_VOCABULARY_SIZE);
+    unsigned long used = 0;
+    if (vocabulary == NULL || zipf == NULL) {
+        BenchmarkFreeWords(vocabulary, TEXT_VOCABULARY_SIZE);
+        free(zipf);
+        return STANDARD_ERROR;
+    }
+    while (used < length) {
+        const char *word = vocabulary[BenchmarkZipf(zipf, TEXT_VOCABULARY_SIZE)];
+        unsigned long wordLength = strlen(word);
+        int separator = BenchmarkRandom() % 16;
+        if (wordLength > length - used) {
+            wordLength = length - used;
+        }
+        memcpy(text + used, word, wordLength);
+        if (BenchmarkRandom() % 10 == 0) {
+            text[used] = toupper((unsigned char) text[used]);
+        }
+        used += wordLength;
+        if (used < length) {
+            text[used++] = (separator == 0) ? '\n' : (separator == 1) ? ',' :
+                    (separator == 2) ? '.' : ' ';
+        }
+    }
+    text[length] = '\0';
+    free(zipf);
+    BenchmarkFreeWords(vocabulary, TEXT_VOCABULARY_SIZE);
+    return SUCCESS;
+}
+
+/**
+ * BenchmarkScatteredList() builds a list holding data in order, but creates its items in a random
+ * order with random-sized allocations in between. Walking it then jumps around a heap several
+ * times bigger than the list, the way a long-lived list does after a lot of churn.
+ *
+ * @param data The items' data, in list order.
+ * @param count How many items to create. Must be at least 1.
+ * @return The head of the list, or NULL if malloc() fails.
+ */
+ListItem *BenchmarkScatteredList(char **data, int count)
+{
+    ListItem **items = calloc(count, sizeof (ListItem *));
+    void **gaps = calloc(count, sizeof (void *));
+    int *order = malloc(count * sizeof (int));
+    int status = (items != NULL && gaps != NULL && order != NULL) ? SUCCESS : STANDARD_ERROR;
+    ListItem *head = NULL;
+    int i;
+    //shuffle the order the items are created in
+    for (i = 0; i < count && status == SUCCESS; i++) {
+        order[i] = i;
+    }
+    for (i = count - 1; i > 0 && status == SUCCESS; i--) {
+        int other = BenchmarkRandom() % (i + 1), swap = order[i];
+        order[i] = order[other];
+        order[other] = swap;
+    }
+    for (i = 0; i < count && status == SUCCESS; i++) {
+        gaps[i] = malloc(1 + BenchmarkRandom() % SCATTER_GAP);
+        items[order[i]] = LinkedListNew(data[order[i]]);
+        if (gaps[i] == NULL || items[order[i]] == NULL) {
+            status = STANDARD_ERROR;
+        }
+    }
+
+    if (status == SUCCESS) {
+        //the items were made on their own, so link them up in data order directly
+        for (i = 1; i < count; i++) {
+            items[i - 1]->nextItem = items[i];
+            items[i]->previousItem = items[i - 1];
+        }
+        head = items[0];
+    } else if (items != NULL) {
+        for (i = 0; i < count; i++) {
+            LinkedListRemove(items[i]);
+        }
+    }
+    //freeing the gaps leaves holes between the items rather than moving them
+    for (i = 0; gaps != NULL && i < count; i++) {
+        free(gaps[i]);
+    }
+    free(items);
+    free(gaps);
+    free(order);
+    return head;
+}
+
+/**
+ * BenchmarkFreeList() removes every item of a list. The data is not freed.
+ *
+ * @param list Any element in the list. NULL is ignored.
+ */
+void BenchmarkFreeList(ListItem *list)
+{
+    ListItem *next;
+    list = LinkedListGetFirst(list);
+    while (list != NULL) {
+        next = list->nextItem;
+        LinkedListRemove(list);
+        list = next;
+    }
+}
@@ -0,0 +1,119 @@
+#ifndef BENCHMARKSUPPORT_H
+#define BENCHMARKSUPPORT_H
+
+#include "LinkedList.h"
+
+/**
+ * @file
+ * Helpers shared by the host benchmarks in this directory: a monotonic clock, a repeatable random
+ * number generator, random words and vocabularies, Zipf-distributed picks and lists whose items are
+ * scattered across the heap, and English-like text.
+ *
+ * The benchmarks are host-only and are left out of the board build. Each one is a program of its
+ * own, built from the project directory together with this file and the modules it measures, for
+ * example:
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/CursorBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o cursor
+ * BOARD.h includes <xc.h> and <GenericTypeDefs.h>, so the include path needs the XC32 headers or
+ * stand-ins for them. The exact command for each benchmark is at the top of its file.
+ */
+
+/**
+ * BenchmarkNow() reads a monotonic clock.
+ *
+ * @return The time in seconds.
+ */
+double BenchmarkNow(void);
+
+/**
+ * BenchmarkSeed() restarts the random number generator, so a benchmark can make the same input
+ * again.
+ *
+ * @param seed Any nonzero number.
+ */
+void BenchmarkSeed(unsigned long seed);
+
+/**
+ * BenchmarkRandom() returns the next number from a 32-bit xorshift generator.
+ *
+ * @return A number from 0 to 0xFFFFFFFF.
+ */
+unsigned long BenchmarkRandom(void);
+
+/**
+ * BenchmarkRandomWord() makes a random lowercase word.
+ *
+ * @param minLength The shortest word to make.
+ * @param maxLength The longest word to make.
+ * @return A malloc()ed word, or NULL if malloc() fails.
+ */
+char *BenchmarkRandomWord(int minLength, int maxLength);
+
+/**
+ * BenchmarkVocabulary() makes an array of size random words with BenchmarkRandomWord(). Words may
+ * repeat, which only matters for very small vocabularies.
+ *
+ * @param size How many words to make.
+ * @param minLength The shortest word to make.
+ * @param maxLength The longest word to make.
+ * @return The words, or NULL if malloc() fails. Free them with BenchmarkFreeWords().
+ */
+char **BenchmarkVocabulary(int size, int minLength, int maxLength);
+
+/**
+ * BenchmarkFreeWords() frees every word in an array from BenchmarkVocabulary() and the array
+ * itself. NULL words are skipped.
+ *
+ * @param words The array to free.
+ * @param count How many words it holds.
+ */
+void BenchmarkFreeWords(char **words, int count);
+
+/**
+ * BenchmarkZipfTable() builds the cumulative weights BenchmarkZipf() picks from, giving rank r a
+ * weight of 1 / r (Zipf's law with s = 1).
+ *
+ * @param size How many ranks there are.
+ * @return The malloc()ed table, or NULL if malloc() fails.
+ */
+double *BenchmarkZipfTable(int size);
+
+/**
+ * BenchmarkZipf() picks a Zipf-distributed rank, so index 0 is the most likely.
+ *
+ * @param table A table from BenchmarkZipfTable().
+ * @param size The size table was built with.
+ * @return An index from 0 to size - 1.
+ */
+int BenchmarkZipf(const double *table, int size);
+
+/**
+ * BenchmarkText() fills a buffer with English-like text: Zipf-distributed words of 1 to 9 letters
+ * from a fixed vocabulary, one in ten capitalized, separated mostly by spaces with some
+ * punctuation and line breaks.
+ *
+ * @param text Where to put the text. Must hold length + 1 bytes, as the text is NUL-terminated.
+ * @param length How many bytes of text to make.
+ * @return SUCCESS, or STANDARD_ERROR if malloc() fails.
+ */
+int BenchmarkText(char *text, unsigned long length);
+
+/**
+ * BenchmarkScatteredList() builds a list holding data in order, but creates its items in a random
+ * order with random-sized allocations in between. Walking it then jumps around a heap several
+ * times bigger than the list, the way a long-lived list does after a lot of churn.
+ *
+ * @param data The items' data, in list order.
+ * @param count How many items to create. Must be at least 1.
+ * @return The head of the list, or NULL if malloc() fails.
+ */
+ListItem *BenchmarkScatteredList(char **data, int count);
+
+/**
+ * BenchmarkFreeList() removes every item of a list. The data is not freed.
+ *
+ * @param list Any element in the list. NULL is ignored.
+ */
+void BenchmarkFreeList(ListItem *list);
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * File:   BloomBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times UnsortedWordCount() on lists with 0% to 90% repeated words. Build it twice, once
+ * as is and once with -DWORD_COUNT_BLOOM_BITS_PER_ITEM=0, to compare with and without the bloom
+ * filter. The checksums should match between the two builds.
+ *     gcc -O2 [-DWORD_COUNT_BLOOM_BITS_PER_ITEM=0] -I. -Ibenchmarks -I<xc.h dir>
+ *         benchmarks/BloomBenchmark.c benchmarks/BenchmarkSupport.c LinkedList.c WordCount.c
+ *         ListTiming.c -pthread -o bloom
+ *     ./bloom [list size, default 6000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "WordCount.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define REPEATS 3
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 6000, percent, i, repeat;
+    char **words = malloc(count * sizeof (char *));
+    int *wordCount = malloc(count * sizeof (int));
+
+    if (words == NULL || wordCount == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    printf("UnsortedWordCount(), %d items (2%% NULL), bloom filter %s, best of %d\n", count,
+            (WORD_COUNT_BLOOM_BITS_PER_ITEM > 0) ? "on" : "off", REPEATS);
+    printf("%10s %10s %22s\n", "repeats", "ms", "checksum");
+    for (percent = 0; percent <= 90; percent += 10) {
+        double best = 1e9, start, elapsed;
+        unsigned long checksum = 0;
+        ListItem *head, *tail;
+
+        //each item repeats an earlier word with the given chance, and is a new word otherwise.
+        //New words are 8 random letters, so they are all but certain to be distinct
+        BenchmarkSeed(12345);
+        for (i = 0; i < count; i++) {
+            if (BenchmarkRandom() % 50 == 0) {
+                words[i] = NULL;
+            } else if (i > 0 && (int) (BenchmarkRandom() % 100) < percent) {
+                words[i] = words[BenchmarkRandom() % i];
+            } else {
+                words[i] = BenchmarkRandomWord(8, 8);
+            }
+        }
+        head = tail = LinkedListNew(words[0]);
+        for (i = 1; i < count; i++) {
+            tail = LinkedListCreateAfter(tail, words[i]);
+        }
+
+        for (repeat = 0; repeat < REPEATS; repeat++) {
+            start = BenchmarkNow();
+            UnsortedWordCount(head, wordCount);
+            elapsed = BenchmarkNow() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        for (i = 0; i < count; i++) {
+            checksum = 31 * checksum + (unsigned long) wordCount[i];
+        }
+        printf("%9d%% %10.1f %22lu\n", percent, best * 1e3, checksum);
+
+        BenchmarkFreeList(head);
+        //free each new word once: a word is new where it first appears
+        for (i = 0; i < count; i++) {
+            if (wordCount[i] > 0) {
+                free(words[i]);
+            }
+        }
+    }
+
+    free(wordCount);
+    free(words);
+    return 0;
+}
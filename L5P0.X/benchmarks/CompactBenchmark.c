@@ -0,0 +1,113 @@
+/*
+ * File:   CompactBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times walking a deliberately fragmented list before and after LinkedListCompact(),
+ * and the compaction itself.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/CompactBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o compact
+ *     ./compact [list size, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define REPEATS 5
+
+// **** Declare any function prototypes here ****
+static unsigned long Walk(ListItem *list);
+static double TimeWalk(ListItem *list, unsigned long *sum);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, i;
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 12);
+    char **data = malloc(count * sizeof (char *));
+    unsigned long before, after;
+    double fragmented, compacted, start, compaction;
+    ListItem *list;
+
+    if (vocabulary == NULL || data == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        data[i] = vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+    list = BenchmarkScatteredList(data, count);
+    if (list == NULL) {
+        printf("Couldn't build the list\n");
+        return 1;
+    }
+
+    fragmented = TimeWalk(list, &before);
+    start = BenchmarkNow();
+    list = LinkedListCompact(list);
+    compaction = BenchmarkNow() - start;
+    if (list == NULL) {
+        printf("LinkedListCompact() failed\n");
+        return 1;
+    }
+    compacted = TimeWalk(list, &after);
+
+    printf("%d items, best of %d walks, ns per item\n", count, REPEATS);
+    printf("  walk, fragmented      %7.2f\n", fragmented * 1e9 / count);
+    printf("  LinkedListCompact()   %7.2f\n", compaction * 1e9 / count);
+    printf("  walk, compacted       %7.2f\n", compacted * 1e9 / count);
+    printf("  compaction pays for itself after %.1f walks\n",
+            compaction / (fragmented - compacted));
+    if (before != after) {
+        printf("The compacted list holds different words\n");
+        return 1;
+    }
+
+    BenchmarkFreeList(list);
+    free(data);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * Follows nextItem from the head, reading the first letter of every word.
+ */
+static unsigned long Walk(ListItem *list)
+{
+    unsigned long sum = 0;
+    for (; list != NULL; list = list->nextItem) {
+        if (LINKEDLIST_DATA(list) != NULL) {
+            sum = 31 * sum + LINKEDLIST_DATA(list)[0];
+        }
+    }
+    return sum;
+}
+
+/*
+ * Returns the best time of REPEATS walks, and the walk's checksum in sum.
+ */
+static double TimeWalk(ListItem *list, unsigned long *sum)
+{
+    double best = 1e9, start, elapsed;
+    int i;
+    for (i = 0; i < REPEATS; i++) {
+        start = BenchmarkNow();
+        *sum = Walk(list);
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    return best;
+}
@@ -0,0 +1,149 @@
+/*
+ * File:   ConstantListBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: what sort.c's ten-word list costs at startup. Building it on the heap with
+ * LinkedListNew() and LinkedListCreateAfterN() is compared with the compile-time constant list,
+ * each followed by LinkedListSize(). For each it reports the mean time and, for one list,
+ * LinkedListAllocationCount() and LinkedListHeapHighWater(). The heap list has to be freed again
+ * before the next run, and that is timed with it. Copying the constant list with
+ * LinkedListCopyOnWrite(), which only happens once the list is about to be changed, is timed too.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/ConstantListBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o constantlist
+ *     ./constantlist [runs, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define WORDS 10
+
+// **** Declare any data types here ****
+typedef enum {
+    HEAP_LIST,
+    CONSTANT_LIST,
+    COPIED_LIST,
+    WAYS
+} ListWay;
+
+// **** Define any module-level, global, or external variables here ****
+//the same words and order as sort.c
+static char dog[] = "dog";
+static char pig1[] = "pig";
+static char pig2[] = "pig";
+static char cow[] = "cow";
+static char cat[] = "cat";
+static char turtle[] = "turtle";
+static char bird[] = "bird";
+static char crab[] = "crab";
+
+static char *words[WORDS] = {crab, turtle, cat, pig2, bird, cow, dog, NULL, cow, pig1};
+
+static const ListItem unsortedWords[] = {
+    LINKEDLIST_CONSTANT_HEAD(unsortedWords, crab),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 1, turtle),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 2, cat),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 3, pig2),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 4, bird),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 5, cow),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 6, dog),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 7, NULL),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 8, cow),
+    LINKEDLIST_CONSTANT_TAIL(unsortedWords, 9, pig1),
+};
+
+static const char *wayNames[WAYS] = {
+    "LinkedListCreateAfterN() + size + free",
+    "constant list + size",
+    "constant list + LinkedListCopyOnWrite()"
+};
+
+// **** Declare any function prototypes here ****
+static int Once(ListWay way);
+
+int main(int argc, char **argv)
+{
+    long runs = (argc > 1) ? atol(argv[1]) : 1000000, run;
+    unsigned long allocations[WAYS], highWater[WAYS];
+    double seconds[WAYS], start;
+    long total;
+    ListWay way;
+
+    if (runs < 1) {
+        printf("Need at least one run\n");
+        return 1;
+    }
+    for (way = HEAP_LIST; way < WAYS; way++) {
+        //one list on its own for the allocation count and the heap
+        LinkedListResetAllocationCount();
+        LinkedListResetHeapHighWater();
+        if (Once(way) != WORDS) {
+            printf("%s didn't give a %d item list\n", wayNames[way], WORDS);
+            return 1;
+        }
+        allocations[way] = LinkedListAllocationCount();
+        highWater[way] = LinkedListHeapHighWater();
+
+        total = 0;
+        start = BenchmarkNow();
+        for (run = 0; run < runs; run++) {
+            total += Once(way);
+        }
+        seconds[way] = BenchmarkNow() - start;
+        if (total != runs * WORDS) {
+            printf("%s lost items\n", wayNames[way]);
+            return 1;
+        }
+    }
+
+    printf("sort.c's %d word list, mean of %ld runs\n", WORDS, runs);
+    printf("%-42s %10s %12s %12s\n", "", "ns", "allocations", "heap bytes");
+    for (way = HEAP_LIST; way < WAYS; way++) {
+        printf("%-42s %10.1f %12lu %12lu\n", wayNames[way], seconds[way] / runs * 1e9,
+                allocations[way], highWater[way]);
+    }
+    return 0;
+}
+
+/*
+ * Gets the word list one way, takes its size and gives back whatever was allocated. Returns the
+ * size, or 0 if allocation failed.
+ */
+static int Once(ListWay way)
+{
+    ListItem *list, *last;
+    int size;
+    if (way == CONSTANT_LIST) {
+        return LinkedListSize((ListItem *) unsortedWords);
+    }
+    if (way == COPIED_LIST) {
+        list = (ListItem *) unsortedWords;
+        if (LinkedListCopyOnWrite(&list, unsortedWords, LINKEDLIST_CONSTANT_SIZE(unsortedWords))
+                != SUCCESS) {
+            return 0;
+        }
+    } else {
+        list = LinkedListNew(words[0]);
+        if (list == NULL || LinkedListCreateAfterN(list, words + 1, WORDS - 1, &last) == NULL) {
+            BenchmarkFreeList(list);
+            return 0;
+        }
+    }
+    size = LinkedListSize(list);
+    BenchmarkFreeList(list);
+    return size;
+}
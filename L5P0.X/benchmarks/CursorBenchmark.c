@@ -0,0 +1,146 @@
+/*
+ * File:   CursorBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times walking a list and reading each item's word, by following nextItem directly and
+ * with a ListCursor at several prefetch distances, on a list built in order and on one whose items
+ * are scattered across the heap.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/CursorBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o cursor
+ *     ./cursor [list size, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define REPEATS 5
+
+// **** Define any module-level, global, or external variables here ****
+static const int prefetchDistances[] = {0, 2, 4, 8, 16};
+
+// **** Declare any function prototypes here ****
+static unsigned long WalkDirectly(ListItem *list);
+static unsigned long WalkWithCursor(ListItem *list, int prefetchDistance);
+static void TimeWalks(const char *name, ListItem *list, int count);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, i;
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 12);
+    char **data = malloc(count * sizeof (char *));
+    ListItem *ordered, *scattered, *tail;
+
+    if (vocabulary == NULL || data == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        data[i] = vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+    ordered = tail = LinkedListNew(data[0]);
+    for (i = 1; i < count && tail != NULL; i++) {
+        tail = LinkedListCreateAfter(tail, data[i]);
+    }
+    scattered = BenchmarkScatteredList(data, count);
+    if (tail == NULL || scattered == NULL) {
+        printf("Couldn't build the lists\n");
+        return 1;
+    }
+
+    printf("%d items, best of %d, ns per item\n", count, REPEATS);
+    TimeWalks("built in order", ordered, count);
+    TimeWalks("scattered", scattered, count);
+
+    BenchmarkFreeList(ordered);
+    BenchmarkFreeList(scattered);
+    free(data);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * Follows nextItem from the head, reading the first letter of every word.
+ */
+static unsigned long WalkDirectly(ListItem *list)
+{
+    unsigned long sum = 0;
+    for (; list != NULL; list = list->nextItem) {
+        if (LINKEDLIST_DATA(list) != NULL) {
+            sum += LINKEDLIST_DATA(list)[0];
+        }
+    }
+    return sum;
+}
+
+/*
+ * Same walk as WalkDirectly(), through a ListCursor.
+ */
+static unsigned long WalkWithCursor(ListItem *list, int prefetchDistance)
+{
+    unsigned long sum = 0;
+    ListCursor cursor;
+    ListItem *item;
+    LinkedListCursorInit(&cursor, list, LIST_FORWARD, prefetchDistance);
+    while ((item = LinkedListCursorNext(&cursor)) != NULL) {
+        if (LINKEDLIST_DATA(item) != NULL) {
+            sum += LINKEDLIST_DATA(item)[0];
+        }
+    }
+    return sum;
+}
+
+/*
+ * Prints the best time per item of each kind of walk over list.
+ */
+static void TimeWalks(const char *name, ListItem *list, int count)
+{
+    double best, start, elapsed;
+    unsigned long expected = WalkDirectly(list), sum;
+    int i, d;
+
+    printf("%s:\n", name);
+    best = 1e9;
+    for (i = 0; i < REPEATS; i++) {
+        start = BenchmarkNow();
+        sum = WalkDirectly(list);
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    printf("  nextItem walk               %6.2f\n", best * 1e9 / count);
+    for (d = 0; d < (int) (sizeof (prefetchDistances) / sizeof (prefetchDistances[0])); d++) {
+        best = 1e9;
+        for (i = 0; i < REPEATS; i++) {
+            start = BenchmarkNow();
+            sum = WalkWithCursor(list, prefetchDistances[d]);
+            elapsed = BenchmarkNow() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        printf("  cursor, prefetch distance %2d %6.2f%s\n", prefetchDistances[d],
+                best * 1e9 / count, (sum == expected) ? "" : " (wrong sum)");
+    }
+    best = 1e9;
+    for (i = 0; i < REPEATS; i++) {
+        start = BenchmarkNow();
+        if (LinkedListSize(list) != count) {
+            printf("  LinkedListSize() is wrong\n");
+        }
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    printf("  LinkedListSize()            %6.2f\n", best * 1e9 / count);
+}
@@ -0,0 +1,131 @@
+/*
+ * File:   ExternalSortBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: measures ListExternalSort throughput on an input several times bigger than its memory
+ * budget, and checks that the words come out in order and that the process stays near the budget.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/ExternalSortBenchmark.c
+ *         benchmarks/BenchmarkSupport.c ListExternalSort.c LinkedList.c ListTiming.c -pthread
+ *         -o externalsort
+ *     ./externalsort [budget in MiB, default 64] [input size / budget, default 10] [temp directory]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListExternalSort.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define MAX_WORD_LENGTH 16
+
+// **** Declare any data types here ****
+/*
+ * What the merge callback remembers to check the output.
+ */
+typedef struct SortCheck {
+    char previous[MAX_WORD_LENGTH + 1];
+    int previousIsNull;
+    unsigned long words;
+    int inOrder;
+} SortCheck;
+
+// **** Declare any function prototypes here ****
+static void RandomWord(char *word);
+static int CheckWord(char *word, void *context);
+
+int main(int argc, char **argv)
+{
+    unsigned long budget = ((argc > 1) ? strtoul(argv[1], NULL, 10) : 64) * 1024 * 1024;
+    unsigned long scale = (argc > 2) ? strtoul(argv[2], NULL, 10) : 10;
+    const char *tempDirectory = (argc > 3) ? argv[3] : NULL;
+    unsigned long inputBytes = 0, words = 0;
+    char word[MAX_WORD_LENGTH + 1];
+    SortCheck check = {"", TRUE, 0, TRUE};
+    ListExternalSort sorter;
+    struct rusage usage;
+    double start, added, finished;
+    int runs;
+
+    if (ListExternalSortInit(&sorter, budget, tempDirectory) != SUCCESS) {
+        printf("Couldn't set up a sort with a %lu byte budget\n", budget);
+        return 1;
+    }
+    //words are made on the fly so the input itself never has to be held in memory
+    start = BenchmarkNow();
+    while (inputBytes < scale * budget) {
+        RandomWord(word);
+        if (ListExternalSortAdd(&sorter, word) != SUCCESS) {
+            printf("ListExternalSortAdd() failed after %lu words\n", words);
+            return 1;
+        }
+        inputBytes += strlen(word) + 1;
+        words++;
+    }
+    added = BenchmarkNow();
+    runs = sorter.runCount + 1;
+    if (ListExternalSortFinish(&sorter, CheckWord, &check) != SUCCESS) {
+        printf("ListExternalSortFinish() failed\n");
+        return 1;
+    }
+    finished = BenchmarkNow();
+    ListExternalSortFree(&sorter);
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("Budget %lu MiB, input %lu MiB (%lu words) in %d runs\n", budget >> 20,
+            inputBytes >> 20, words, runs);
+    printf("Add (sort and spill runs): %.2f s, %.1f MiB/s\n", added - start,
+            inputBytes / (added - start) / (1024 * 1024));
+    printf("Finish (merge):            %.2f s, %.1f MiB/s\n", finished - added,
+            inputBytes / (finished - added) / (1024 * 1024));
+    printf("Total:                     %.2f s, %.1f MiB/s, %.2f million words/s\n",
+            finished - start, inputBytes / (finished - start) / (1024 * 1024),
+            words / (finished - start) / 1e6);
+    printf("Peak resident memory: %ld MiB\n", usage.ru_maxrss >> 10);
+    printf("Output: %lu words, %s\n", check.words,
+            (check.words == words && check.inOrder) ? "in order" : "NOT IN ORDER");
+    return (check.words == words && check.inOrder) ? 0 : 1;
+}
+
+/*
+ * Makes a random lowercase word of 1 to MAX_WORD_LENGTH letters in place, as a malloc() per word
+ * would cost as much as adding it.
+ */
+static void RandomWord(char *word)
+{
+    int length = 1 + BenchmarkRandom() % MAX_WORD_LENGTH, i;
+    for (i = 0; i < length; i++) {
+        word[i] = 'a' + BenchmarkRandom() % 26;
+    }
+    word[length] = '\0';
+}
+
+/*
+ * ListExternalSortCallback that counts the words and checks each one against the one before.
+ */
+static int CheckWord(char *word, void *context)
+{
+    SortCheck *check = context;
+    if (!check->previousIsNull && LinkedListCompare(check->previous, word) > 0) {
+        check->inOrder = FALSE;
+    }
+    if (word != NULL) {
+        strcpy(check->previous, word);
+        check->previousIsNull = FALSE;
+    }
+    check->words++;
+    return SUCCESS;
+}
@@ -0,0 +1,129 @@
+/*
+ * File:   GetAtBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times LinkedListGetAt() on sequential, strided, backward and random index patterns,
+ * against walking from the head for every index, and checks that both find the same items.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/GetAtBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o getat
+ *     ./getat [list size, default 100000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define STRIDE 7
+#define WALK_SAMPLE 200 //walking from the head is slow, so only every 200th index is timed
+
+// **** Declare any data types here ****
+typedef enum {
+    SEQUENTIAL,
+    STRIDED,
+    BACKWARD,
+    RANDOM,
+    PATTERNS
+} IndexPattern;
+
+// **** Define any module-level, global, or external variables here ****
+static const char *patternNames[PATTERNS] = {
+    "sequential",
+    "stride 7",
+    "backward",
+    "random"
+};
+
+// **** Declare any function prototypes here ****
+static ListItem *WalkFromHead(ListItem *head, int index);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 100000, i;
+    int *indices = malloc(count * sizeof (int));
+    ListItem *head, *tail, *item;
+    IndexPattern pattern;
+
+    if (indices == NULL || count < WALK_SAMPLE) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    head = tail = LinkedListNew(NULL);
+    for (i = 1; i < count && tail != NULL; i++) {
+        tail = LinkedListCreateAfter(tail, NULL);
+    }
+    if (tail == NULL) {
+        printf("Couldn't build the list\n");
+        return 1;
+    }
+
+    printf("%d items, ns per call\n", count);
+    printf("%-12s %12s %16s\n", "", "GetAt", "walk from head");
+    for (pattern = SEQUENTIAL; pattern < PATTERNS; pattern++) {
+        double start, getAt, walk;
+        for (i = 0; i < count; i++) {
+            switch (pattern) {
+            case SEQUENTIAL:
+                indices[i] = i;
+                break;
+            case STRIDED:
+                indices[i] = (int) ((long) i * STRIDE % count);
+                break;
+            case BACKWARD:
+                indices[i] = count - 1 - i;
+                break;
+            default:
+                indices[i] = BenchmarkRandom() % count;
+                break;
+            }
+        }
+
+        start = BenchmarkNow();
+        for (i = 0; i < count; i++) {
+            item = LinkedListGetAt(head, indices[i]);
+        }
+        getAt = (BenchmarkNow() - start) / count;
+        start = BenchmarkNow();
+        for (i = 0; i < count; i += WALK_SAMPLE) {
+            item = WalkFromHead(head, indices[i]);
+        }
+        walk = (BenchmarkNow() - start) / (count / WALK_SAMPLE);
+
+        for (i = 0; i < count; i += WALK_SAMPLE) {
+            if (LinkedListGetAt(head, indices[i]) != WalkFromHead(head, indices[i])) {
+                printf("LinkedListGetAt(%d) found the wrong item\n", indices[i]);
+                return 1;
+            }
+        }
+        printf("%-12s %12.1f %16.1f\n", patternNames[pattern], getAt * 1e9, walk * 1e9);
+    }
+    (void) item;
+
+    BenchmarkFreeList(head);
+    free(indices);
+    return 0;
+}
+
+/*
+ * Positional access without a finger: follows nextItem index times from the head. The volatile
+ * read stops the compiler from skipping the walk when the result isn't used.
+ */
+static ListItem *WalkFromHead(ListItem *head, int index)
+{
+    while (head != NULL && index-- > 0) {
+        head = *(ListItem * volatile *) &head->nextItem;
+    }
+    return head;
+}
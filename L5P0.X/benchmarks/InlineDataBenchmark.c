@@ -0,0 +1,173 @@
+/*
+ * File:   InlineDataBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times sorting and counting words that live far apart on the heap. Build it twice, with
+ * and without LINKEDLIST_INLINE_DATA, to compare inline and external storage of short words. The
+ * checksums should match between the two builds.
+ *     gcc -O2 [-DLINKEDLIST_INLINE_DATA] -I. -Ibenchmarks -I<xc.h dir>
+ *         benchmarks/InlineDataBenchmark.c benchmarks/BenchmarkSupport.c LinkedList.c
+ *         WordCount.c ListTiming.c -pthread -o inlinedata
+ *     ./inlinedata [list size, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "WordCount.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define GAP 200 //most bytes left between two vocabulary words
+#define UNSORTED_COUNT_SIZE 8000 //UnsortedWordCount() is quadratic
+#define REPEATS 3
+
+// **** Declare any function prototypes here ****
+static char **ScatteredVocabulary(void);
+static ListItem *BuildList(char **words, int count);
+static int CountRun(char *word, int count, void *context);
+static unsigned long Checksum(const int *wordCount, int count);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, i, repeat;
+    char **vocabulary = ScatteredVocabulary();
+    char **words = malloc(count * sizeof (char *));
+    int *wordCount = malloc(count * sizeof (int));
+    double sort = 1e9, runs = 1e9, sharded = 1e9, unsorted = 1e9, start;
+    unsigned long runChecksum = 0, shardedChecksum = 0, unsortedChecksum = 0;
+    ListItem *list;
+
+    if (vocabulary == NULL || words == NULL || wordCount == NULL
+            || count < UNSORTED_COUNT_SIZE) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        words[i] = vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        double elapsed;
+        list = BuildList(words, count);
+        start = BenchmarkNow();
+        LinkedListSortNatural(list);
+        elapsed = BenchmarkNow() - start;
+        sort = (elapsed < sort) ? elapsed : sort;
+        runChecksum = 0;
+        start = BenchmarkNow();
+        SortedWordRunsForEach(list, CountRun, &runChecksum);
+        elapsed = BenchmarkNow() - start;
+        runs = (elapsed < runs) ? elapsed : runs;
+        BenchmarkFreeList(list);
+
+        list = BuildList(words, count);
+        start = BenchmarkNow();
+        ShardedWordCount(list, wordCount, 1);
+        elapsed = BenchmarkNow() - start;
+        sharded = (elapsed < sharded) ? elapsed : sharded;
+        shardedChecksum = Checksum(wordCount, count);
+        BenchmarkFreeList(list);
+
+        list = BuildList(words, UNSORTED_COUNT_SIZE);
+        start = BenchmarkNow();
+        UnsortedWordCount(list, wordCount);
+        elapsed = BenchmarkNow() - start;
+        unsorted = (elapsed < unsorted) ? elapsed : unsorted;
+        unsortedChecksum = Checksum(wordCount, UNSORTED_COUNT_SIZE);
+        BenchmarkFreeList(list);
+    }
+
+#ifdef LINKEDLIST_INLINE_DATA
+    printf("Inline storage, words under %d bytes are copied into the ListItem\n",
+            LINKEDLIST_INLINE_BYTES);
+#else
+    printf("External storage, every word is read through data\n");
+#endif
+    printf("%d words, best of %d, ms\n", count, REPEATS);
+    printf("  LinkedListSortNatural()     %8.1f\n", sort * 1e3);
+    printf("  SortedWordRunsForEach()     %8.1f  checksum %lu\n", runs * 1e3, runChecksum);
+    printf("  ShardedWordCount(), 1 shard %8.1f  checksum %lu\n", sharded * 1e3,
+            shardedChecksum);
+    printf("  UnsortedWordCount(), %d   %8.1f  checksum %lu\n", UNSORTED_COUNT_SIZE,
+            unsorted * 1e3, unsortedChecksum);
+
+    free(wordCount);
+    free(words);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * Makes VOCABULARY_SIZE random words of 3 to 12 letters with random gaps between them, so reading
+ * a word is likely to miss the cache.
+ */
+static char **ScatteredVocabulary(void)
+{
+    char **words = malloc(VOCABULARY_SIZE * sizeof (char *));
+    void **gaps = malloc(VOCABULARY_SIZE * sizeof (void *));
+    int i;
+    if (words == NULL || gaps == NULL) {
+        free(words);
+        free(gaps);
+        return NULL;
+    }
+    for (i = 0; i < VOCABULARY_SIZE; i++) {
+        words[i] = BenchmarkRandomWord(3, 12);
+        gaps[i] = malloc(1 + BenchmarkRandom() % GAP);
+    }
+    for (i = 0; i < VOCABULARY_SIZE; i++) {
+        free(gaps[i]);
+    }
+    free(gaps);
+    return words;
+}
+
+/*
+ * Builds a list of the first count words, in order, and returns its head.
+ */
+static ListItem *BuildList(char **words, int count)
+{
+    ListItem *head = LinkedListNew(words[0]), *tail = head;
+    int i;
+    for (i = 1; i < count; i++) {
+        tail = LinkedListCreateAfter(tail, words[i]);
+    }
+    return head;
+}
+
+/*
+ * WordRunCallback that folds every run's length into a checksum.
+ */
+static int CountRun(char *word, int count, void *context)
+{
+    unsigned long *checksum = context;
+    (void) word;
+    *checksum = 31 * *checksum + count;
+    return SUCCESS;
+}
+
+/*
+ * Folds a wordCount array into a checksum.
+ */
+static unsigned long Checksum(const int *wordCount, int count)
+{
+    unsigned long checksum = 0;
+    int i;
+    for (i = 0; i < count; i++) {
+        checksum = 31 * checksum + (unsigned long) wordCount[i];
+    }
+    return checksum;
+}
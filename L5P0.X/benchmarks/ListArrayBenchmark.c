@@ -0,0 +1,198 @@
+/*
+ * File:   ListArrayBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: runs the same scans over a regular list and a ListArray holding the same words, once
+ * in creation order and once after sorting, times the sorts themselves, and reports the memory
+ * each takes per node. Both must agree on every result.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/ListArrayBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListArray.c ListTiming.c -pthread
+ *         -o listarray
+ *     ./listarray [nodes, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListArray.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define REPEATS 5
+
+// **** Declare any data types here ****
+typedef enum {
+    COUNT_NULL,
+    TOTAL_LENGTH,
+    SORT,
+    SORTED_COUNT_NULL,
+    SORTED_TOTAL_LENGTH,
+    SORTED_CHECK,
+    OPERATIONS
+} Operation;
+
+typedef enum {
+    LIST_ITEM,
+    LIST_ARRAY,
+    LAYOUTS
+} Layout;
+
+// **** Define any module-level, global, or external variables here ****
+static const char *operationNames[OPERATIONS] = {
+    "count NULLs, creation order",
+    "total length, creation order",
+    "sort (SortNatural vs ListArray)",
+    "count NULLs, after sort",
+    "total length, after sort",
+    "is-sorted check, after sort"
+};
+
+// **** Declare any function prototypes here ****
+static unsigned long ListItemScan(ListItem *list, Operation operation);
+static unsigned long ListArrayScan(ListArray *array, Operation operation);
+static void Keep(double *best, double start);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, repeat, i;
+    char **words = malloc(count * sizeof (char *));
+    double best[OPERATIONS][LAYOUTS];
+    unsigned long results[OPERATIONS][LAYOUTS];
+    Operation operation;
+    ListArray array;
+    ListItem *list;
+    double start;
+    int tail;
+
+    if (words == NULL || count < 1) {
+        printf("Couldn't set up %d nodes\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        words[i] = (BenchmarkRandom() % 20 == 0) ? NULL : BenchmarkRandomWord(1, 12);
+    }
+    for (operation = COUNT_NULL; operation < OPERATIONS; operation++) {
+        best[operation][LIST_ITEM] = best[operation][LIST_ARRAY] = 1e9;
+    }
+
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        list = LinkedListNew(words[0]);
+        for (i = 1; i < count; i++) {
+            list = LinkedListCreateAfter(list, words[i]);
+        }
+        list = LinkedListGetFirst(list);
+        for (operation = COUNT_NULL; operation < OPERATIONS; operation++) {
+            start = BenchmarkNow();
+            if (operation == SORT) {
+                LinkedListSortNatural(list);
+                list = LinkedListGetFirst(list);
+                results[SORT][LIST_ITEM] = 0;
+            } else {
+                results[operation][LIST_ITEM] = ListItemScan(list, operation);
+            }
+            Keep(&best[operation][LIST_ITEM], start);
+        }
+        BenchmarkFreeList(list);
+
+        ListArrayInit(&array, count);
+        tail = LIST_ARRAY_NONE;
+        for (i = 0; i < count; i++) {
+            tail = ListArrayCreateAfter(&array, tail, words[i]);
+        }
+        for (operation = COUNT_NULL; operation < OPERATIONS; operation++) {
+            start = BenchmarkNow();
+            if (operation == SORT) {
+                ListArraySort(&array);
+                results[SORT][LIST_ARRAY] = 0;
+            } else {
+                results[operation][LIST_ARRAY] = ListArrayScan(&array, operation);
+            }
+            Keep(&best[operation][LIST_ARRAY], start);
+        }
+        ListArrayFree(&array);
+    }
+
+    printf("%d nodes, 5%% NULL, random 1 to 12 letter words, best of %d, ms\n", count, REPEATS);
+    printf("%-34s %10s %10s\n", "", "ListItem", "ListArray");
+    for (operation = COUNT_NULL; operation < OPERATIONS; operation++) {
+        printf("%-34s %10.2f %10.2f\n", operationNames[operation],
+                best[operation][LIST_ITEM] * 1e3, best[operation][LIST_ARRAY] * 1e3);
+    }
+    printf("%-34s %10lu %10lu\n", "bytes per node, before malloc()",
+            (unsigned long) sizeof (ListItem),
+            (unsigned long) (3 * sizeof (int) + sizeof (char *)));
+    for (operation = COUNT_NULL; operation < OPERATIONS; operation++) {
+        if (results[operation][LIST_ITEM] != results[operation][LIST_ARRAY]) {
+            printf("%s gave %lu and %lu\n", operationNames[operation],
+                    results[operation][LIST_ITEM], results[operation][LIST_ARRAY]);
+            return 1;
+        }
+    }
+    if (results[SORTED_CHECK][LIST_ITEM] != TRUE) {
+        printf("The sorted lists aren't sorted\n");
+        return 1;
+    }
+
+    BenchmarkFreeWords(words, count);
+    return 0;
+}
+
+/*
+ * Walks a regular list from its head for one of the scans: counts the NULL items, adds up the
+ * lengths of the words, or checks that each word is in order with the one before it.
+ */
+static unsigned long ListItemScan(ListItem *list, Operation operation)
+{
+    unsigned long result = 0;
+    ListItem *item;
+    if (operation == SORTED_CHECK) {
+        for (item = list; item->nextItem != NULL; item = item->nextItem) {
+            if (LinkedListCompare(item->data, item->nextItem->data) > 0) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+    for (item = list; item != NULL; item = item->nextItem) {
+        if (operation == COUNT_NULL || operation == SORTED_COUNT_NULL) {
+            result += (item->data == NULL);
+        } else if (item->data != NULL) {
+            result += strlen(item->data);
+        }
+    }
+    return result;
+}
+
+/*
+ * The same scans with the ListArray functions.
+ */
+static unsigned long ListArrayScan(ListArray *array, Operation operation)
+{
+    if (operation == SORTED_CHECK) {
+        return ListArrayIsSorted(array);
+    } else if (operation == COUNT_NULL || operation == SORTED_COUNT_NULL) {
+        return ListArrayCountNull(array);
+    }
+    return ListArrayTotalLength(array);
+}
+
+/*
+ * Keeps the time since start in best if it beats it.
+ */
+static void Keep(double *best, double start)
+{
+    double elapsed = BenchmarkNow() - start;
+    *best = (elapsed < *best) ? elapsed : *best;
+}
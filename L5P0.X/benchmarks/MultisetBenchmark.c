@@ -0,0 +1,127 @@
+/*
+ * File:   MultisetBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: counts Zipf-distributed words once with a regular list (build,
+ * LinkedListSortNatural(), SortedWordCount()) and once with a ListMultiset (add,
+ * ListMultisetSort(), ListMultisetWordCount()), and reports time and node memory for both. The
+ * counts must match.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/MultisetBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListMultiset.c WordCount.c ListTiming.c
+ *         -pthread -o multiset
+ *     ./multiset [words vocabulary], by default 100000 10000 and then 1000000 50000
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListMultiset.h"
+#include "WordCount.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define REPEATS 3
+
+// **** Declare any function prototypes here ****
+static int Run(int count, int vocabularySize);
+
+int main(int argc, char **argv)
+{
+    if (argc > 2) {
+        return Run(atoi(argv[1]), atoi(argv[2]));
+    }
+    if (Run(100000, 10000) != 0) {
+        return 1;
+    }
+    return Run(1000000, 50000);
+}
+
+/*
+ * Runs both ways of counting count words drawn from a vocabulary of the given size and prints the
+ * results. Returns 0, or 1 if the counts differ or something couldn't be allocated.
+ */
+static int Run(int count, int vocabularySize)
+{
+    char **vocabulary = BenchmarkVocabulary(vocabularySize, 3, 10);
+    double *zipf = BenchmarkZipfTable(vocabularySize);
+    char **words = malloc(count * sizeof (char *));
+    int *listCount = malloc(count * sizeof (int));
+    int *setCount = malloc(count * sizeof (int));
+    double list = 1e9, set = 1e9, listCounting = 1e9, setCounting = 1e9, start, counted, elapsed;
+    unsigned long indexBytes = 0;
+    int distinct = 0, repeat, i;
+    ListMultiset multiset;
+    ListItem *head, *tail;
+
+    if (vocabulary == NULL || zipf == NULL || words == NULL || listCount == NULL
+            || setCount == NULL || count < 1) {
+        printf("Couldn't set up %d words\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        words[i] = vocabulary[BenchmarkZipf(zipf, vocabularySize)];
+    }
+
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        start = BenchmarkNow();
+        head = tail = LinkedListNew(words[0]);
+        for (i = 1; i < count; i++) {
+            tail = LinkedListCreateAfter(tail, words[i]);
+        }
+        LinkedListSortNatural(head);
+        head = LinkedListGetFirst(tail);
+        counted = BenchmarkNow();
+        SortedWordCount(head, listCount);
+        elapsed = BenchmarkNow();
+        list = (elapsed - start < list) ? elapsed - start : list;
+        listCounting = (elapsed - counted < listCounting) ? elapsed - counted : listCounting;
+        BenchmarkFreeList(head);
+
+        start = BenchmarkNow();
+        ListMultisetInit(&multiset);
+        for (i = 0; i < count; i++) {
+            ListMultisetAdd(&multiset, words[i], 1);
+        }
+        ListMultisetSort(&multiset);
+        counted = BenchmarkNow();
+        ListMultisetWordCount(&multiset, setCount);
+        elapsed = BenchmarkNow();
+        set = (elapsed - start < set) ? elapsed - start : set;
+        setCounting = (elapsed - counted < setCounting) ? elapsed - counted : setCounting;
+        distinct = multiset.distinct;
+        indexBytes = multiset.index.capacity * sizeof (WordCountPair)
+                + multiset.capacity * sizeof (ListMultisetItem *);
+        ListMultisetFree(&multiset);
+    }
+
+    printf("%d Zipf words, %d distinct of a %d word vocabulary, best of %d\n", count, distinct,
+            vocabularySize, REPEATS);
+    printf("  list:     %8.1f ms (counting alone %7.2f ms), %lu KB of nodes\n", list * 1e3,
+            listCounting * 1e3, (unsigned long) count * sizeof (ListItem) / 1024);
+    printf("  multiset: %8.1f ms (counting alone %7.2f ms), %lu KB of nodes + %lu KB of index\n",
+            set * 1e3, setCounting * 1e3,
+            (unsigned long) distinct * sizeof (ListMultisetItem) / 1024, indexBytes / 1024);
+    if (memcmp(listCount, setCount, count * sizeof (int)) != 0) {
+        printf("The counts differ\n");
+        return 1;
+    }
+
+    free(setCount);
+    free(listCount);
+    free(words);
+    free(zipf);
+    BenchmarkFreeWords(vocabulary, vocabularySize);
+    return 0;
+}
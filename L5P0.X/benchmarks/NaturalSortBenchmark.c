@@ -0,0 +1,157 @@
+/*
+ * File:   NaturalSortBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times LinkedListSortNatural() on sorted, reversed, sorted with a few words appended
+ * and random input, with LinkedListSort() on a smaller list for comparison, since an insertion sort
+ * can't finish a big random list in reasonable time.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/NaturalSortBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o naturalsort
+ *     ./naturalsort [list size, default 200000] [insertion sort list size, default 10000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define APPENDED 20
+#define REPEATS 3
+
+// **** Declare any data types here ****
+typedef enum {
+    SORTED,
+    REVERSED,
+    APPENDED_TO_SORTED,
+    RANDOM,
+    SHAPES
+} InputShape;
+
+typedef int (*SortFunction)(ListItem *list);
+
+// **** Define any module-level, global, or external variables here ****
+static const char *shapeNames[SHAPES] = {
+    "sorted",
+    "reversed",
+    "sorted + 20 appended",
+    "random"
+};
+
+// **** Declare any function prototypes here ****
+static int CompareWords(const void *first, const void *second);
+static void MakeInput(char **input, char **words, int count, InputShape shape);
+static double TimeSort(SortFunction sort, char **input, int count);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 200000;
+    int smallCount = (argc > 2) ? atoi(argv[2]) : 10000, i;
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 12);
+    char **words = malloc(count * sizeof (char *));
+    char **input = malloc(count * sizeof (char *));
+    InputShape shape;
+
+    if (vocabulary == NULL || words == NULL || input == NULL || count <= APPENDED
+            || smallCount <= APPENDED || smallCount > count) {
+        printf("Couldn't set up %d and %d item lists\n", count, smallCount);
+        return 1;
+    }
+    //about 2% NULLs, which sort first
+    for (i = 0; i < count; i++) {
+        words[i] = (BenchmarkRandom() % 50 == 0) ? NULL :
+                vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+
+    printf("Best of %d, ms\n", REPEATS);
+    printf("%-22s %12s %12s %15s\n", "", "SortNatural", "SortNatural", "LinkedListSort");
+    printf("%-22s %12d %12d %15d\n", "items", count, smallCount, smallCount);
+    for (shape = SORTED; shape < SHAPES; shape++) {
+        double natural, smallNatural, insertion;
+        MakeInput(input, words, count, shape);
+        natural = TimeSort(LinkedListSortNatural, input, count);
+        MakeInput(input, words, smallCount, shape);
+        smallNatural = TimeSort(LinkedListSortNatural, input, smallCount);
+        insertion = TimeSort(LinkedListSort, input, smallCount);
+        printf("%-22s %12.2f %12.2f %15.2f\n", shapeNames[shape], natural * 1e3,
+                smallNatural * 1e3, insertion * 1e3);
+    }
+
+    free(input);
+    free(words);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * qsort() comparison in LinkedListSort() order.
+ */
+static int CompareWords(const void *first, const void *second)
+{
+    return LinkedListCompare(*(char * const *) first, *(char * const *) second);
+}
+
+/*
+ * Copies the first count words into input, arranged in the given shape.
+ */
+static void MakeInput(char **input, char **words, int count, InputShape shape)
+{
+    int i;
+    memcpy(input, words, count * sizeof (char *));
+    if (shape == RANDOM) {
+        return;
+    }
+    qsort(input, (shape == APPENDED_TO_SORTED) ? count - APPENDED : count, sizeof (char *),
+            CompareWords);
+    if (shape == REVERSED) {
+        for (i = 0; i < count / 2; i++) {
+            char *swap = input[i];
+            input[i] = input[count - 1 - i];
+            input[count - 1 - i] = swap;
+        }
+    }
+}
+
+/*
+ * Builds a list of input, sorts it and checks the result, REPEATS times, and returns the best time
+ * of the sort alone.
+ */
+static double TimeSort(SortFunction sort, char **input, int count)
+{
+    double best = 1e9, start, elapsed;
+    ListItem *list, *item;
+    int i, j;
+    for (i = 0; i < REPEATS; i++) {
+        list = LinkedListNew(input[0]);
+        for (j = 1; j < count; j++) {
+            list = LinkedListCreateAfter(list, input[j]);
+        }
+        start = BenchmarkNow();
+        sort(list);
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+
+        item = LinkedListGetFirst(list);
+        for (; item->nextItem != NULL; item = item->nextItem) {
+            if (LinkedListCompare(item->data, item->nextItem->data) > 0) {
+                printf("The list isn't sorted\n");
+                exit(1);
+            }
+        }
+        BenchmarkFreeList(list);
+    }
+    return best;
+}
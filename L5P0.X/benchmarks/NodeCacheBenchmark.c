@@ -0,0 +1,207 @@
+/*
+ * File:   NodeCacheBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: list churn on 1, 2, 4 and 8 threads, each building LIST_LENGTH item lists with
+ * LinkedListCreateAfter() and tearing them down with LinkedListRemove(), in million operations per
+ * second. Each thread either frees its own lists or hands them to the next thread to free. Build it
+ * twice, once as is and once with -DLINKEDLIST_NODE_CACHE and ListNodeCache.c, to compare plain
+ * malloc() with the node cache.
+ *     gcc -O2 [-DLINKEDLIST_NODE_CACHE] -I. -Ibenchmarks -I<xc.h dir>
+ *         benchmarks/NodeCacheBenchmark.c benchmarks/BenchmarkSupport.c LinkedList.c
+ *         [ListNodeCache.c] ListTiming.c -pthread -o nodecache
+ *     ./nodecache [lists per thread, default 4000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+#ifdef LINKEDLIST_NODE_CACHE
+#include "ListNodeCache.h"
+#endif
+
+// **** Set any macros or preprocessor directives here ****
+#define LIST_LENGTH 256
+#define MAX_THREADS 8
+#define REPEATS 3
+
+// **** Declare any data types here ****
+typedef struct {
+    int thread;
+    int threads;
+    int lists;
+    int crossThread;
+    unsigned long operations; //ListItems created plus ListItems removed
+} ChurnWorker;
+
+// **** Define any module-level, global, or external variables here ****
+static char word[] = "churn";
+
+//mailboxes[i] holds a list handed to thread i to free, or NULL
+static ListItem *mailboxes[MAX_THREADS];
+
+//how many threads have built all their lists
+static int finished;
+
+// **** Declare any function prototypes here ****
+static double Run(int threads, int lists, int crossThread);
+static void *Churn(void *context);
+static unsigned long FreeList(ListItem *list);
+static unsigned long FreeMailbox(int thread);
+
+int main(int argc, char **argv)
+{
+    int lists = (argc > 1) ? atoi(argv[1]) : 4000, threads;
+
+    if (lists < 1) {
+        printf("Need at least one list per thread\n");
+        return 1;
+    }
+#ifdef LINKEDLIST_NODE_CACHE
+    printf("node cache, ");
+#else
+    printf("plain malloc(), ");
+#endif
+    printf("%d lists of %d items per thread, best of %d, million ops/sec\n", lists, LIST_LENGTH,
+            REPEATS);
+    printf("%8s %12s %20s\n", "threads", "own lists", "cross-thread frees");
+    for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        double own = Run(threads, lists, FALSE), cross = Run(threads, lists, TRUE);
+        if (own == 0 || cross == 0) {
+            printf("Couldn't run %d threads\n", threads);
+            return 1;
+        }
+        printf("%8d %12.1f %20.1f\n", threads, own, cross);
+    }
+#ifdef LINKEDLIST_NODE_CACHE
+    ListNodeCacheDrain();
+#endif
+    return 0;
+}
+
+/*
+ * Runs the churn on the given number of threads REPEATS times and returns the best rate in
+ * million operations per second, or 0 if a thread couldn't be started or ran out of memory.
+ */
+static double Run(int threads, int lists, int crossThread)
+{
+    ChurnWorker workers[MAX_THREADS];
+    pthread_t ids[MAX_THREADS];
+    double best = 0, start, elapsed;
+    unsigned long operations;
+    int repeat, i;
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        for (i = 0; i < threads; i++) {
+            workers[i].thread = i;
+            workers[i].threads = threads;
+            workers[i].lists = lists;
+            workers[i].crossThread = crossThread;
+            workers[i].operations = 0;
+        }
+        finished = 0;
+        start = BenchmarkNow();
+        for (i = 0; i < threads; i++) {
+            if (pthread_create(&ids[i], NULL, Churn, &workers[i]) != 0) {
+                return 0;
+            }
+        }
+        operations = 0;
+        for (i = 0; i < threads; i++) {
+            pthread_join(ids[i], NULL);
+            operations += workers[i].operations;
+        }
+        elapsed = BenchmarkNow() - start;
+        if (operations < (unsigned long) threads * lists * LIST_LENGTH) {
+            return 0;
+        }
+        best = (operations / elapsed / 1e6 > best) ? operations / elapsed / 1e6 : best;
+        //lists still waiting in a mailbox are freed outside the timing
+        for (i = 0; i < threads; i++) {
+            FreeMailbox(i);
+        }
+    }
+    return best;
+}
+
+/*
+ * Thread body: builds worker->lists lists and frees each one itself or, for cross-thread frees,
+ * puts it in the next thread's mailbox and frees what the previous thread left in its own. While
+ * the next mailbox is still full it keeps emptying its own, and once done it goes on emptying it
+ * until every thread is, so no thread is left waiting on one that has stopped.
+ */
+static void *Churn(void *context)
+{
+    ChurnWorker *worker = context;
+    int next = (worker->thread + 1) % worker->threads, list, i;
+    ListItem *head, *tail, *empty;
+    for (list = 0; list < worker->lists; list++) {
+        head = tail = LinkedListNew(word);
+        for (i = 1; i < LIST_LENGTH && tail != NULL; i++) {
+            tail = LinkedListCreateAfter(tail, word);
+        }
+        if (tail == NULL) {
+            FreeList(head);
+            break;
+        }
+        worker->operations += LIST_LENGTH;
+        if (!worker->crossThread) {
+            worker->operations += FreeList(head);
+            continue;
+        }
+        empty = NULL;
+        while (!__atomic_compare_exchange_n(&mailboxes[next], &empty, head, FALSE,
+                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            worker->operations += FreeMailbox(worker->thread);
+            empty = NULL;
+            sched_yield();
+        }
+        worker->operations += FreeMailbox(worker->thread);
+    }
+    if (worker->crossThread) {
+        __atomic_add_fetch(&finished, 1, __ATOMIC_ACQ_REL);
+        while (__atomic_load_n(&finished, __ATOMIC_ACQUIRE) < worker->threads) {
+            worker->operations += FreeMailbox(worker->thread);
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Removes every item of a list, given by its head, and returns how many there were.
+ */
+static unsigned long FreeList(ListItem *list)
+{
+    unsigned long removed = 0;
+    ListItem *next;
+    while (list != NULL) {
+        next = list->nextItem;
+        LinkedListRemove(list);
+        list = next;
+        removed++;
+    }
+    return removed;
+}
+
+/*
+ * Takes the list out of a thread's mailbox, if there is one, frees it and returns how many items it
+ * had.
+ */
+static unsigned long FreeMailbox(int thread)
+{
+    return FreeList(__atomic_exchange_n(&mailboxes[thread], NULL, __ATOMIC_ACQ_REL));
+}
@@ -0,0 +1,166 @@
+/*
+ * File:   PartitionNullBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times LinkedListSortNatural(), which partitions out the NULLs as its first stage, on
+ * lists scattered across the heap with 10%, 50% and 90% NULL items, in random and already sorted
+ * order, next to LinkedListPartitionNull() alone. It then compares LinkedListPartitionNull() with
+ * moving the NULLs to the front by removing them and creating new items, including how many
+ * ListItems each allocates. Both ways must leave the same order.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/PartitionNullBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTiming.c -pthread -o partitionnull
+ *     ./partitionnull [list size, default 300000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define REPEATS 5
+
+// **** Declare any function prototypes here ****
+static ListItem *RemoveAndRecreate(ListItem *list);
+static int SameOrder(ListItem *first, ListItem *second);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 300000, percent, repeat, i;
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 10);
+    char **words = malloc(count * sizeof (char *));
+    double partitionTime = 1e9, recreateTime = 1e9, start, elapsed;
+    unsigned int partitionAllocations = 0, recreateAllocations = 0;
+    ListItem *list, *other;
+
+    if (vocabulary == NULL || words == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+
+    printf("%d items, best of %d, ms\n", count, REPEATS);
+    printf("%-10s %16s %16s %16s\n", "", "SortNatural", "already sorted", "partition alone");
+    for (percent = 10; percent <= 90; percent += 40) {
+        double random = 1e9, sorted = 1e9, partition = 1e9;
+        for (i = 0; i < count; i++) {
+            words[i] = ((int) (BenchmarkRandom() % 100) < percent) ? NULL
+                    : vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+        }
+        for (repeat = 0; repeat < REPEATS; repeat++) {
+            list = BenchmarkScatteredList(words, count);
+            start = BenchmarkNow();
+            LinkedListSortNatural(list);
+            elapsed = BenchmarkNow() - start;
+            random = (elapsed < random) ? elapsed : random;
+            start = BenchmarkNow();
+            LinkedListSortNatural(list);
+            elapsed = BenchmarkNow() - start;
+            sorted = (elapsed < sorted) ? elapsed : sorted;
+            BenchmarkFreeList(list);
+
+            list = BenchmarkScatteredList(words, count);
+            start = BenchmarkNow();
+            LinkedListPartitionNull(list);
+            elapsed = BenchmarkNow() - start;
+            partition = (elapsed < partition) ? elapsed : partition;
+            BenchmarkFreeList(list);
+        }
+        printf("%8d%% %16.1f %16.1f %16.1f\n", percent, random * 1e3, sorted * 1e3,
+                partition * 1e3);
+    }
+
+    //words still holds the 90% list, so go back to 50% for the standalone comparison
+    for (i = 0; i < count; i++) {
+        words[i] = (BenchmarkRandom() % 2 == 0) ? NULL
+                : vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        list = BenchmarkScatteredList(words, count);
+        LinkedListResetAllocationCount();
+        start = BenchmarkNow();
+        list = LinkedListPartitionNull(list);
+        elapsed = BenchmarkNow() - start;
+        partitionTime = (elapsed < partitionTime) ? elapsed : partitionTime;
+        partitionAllocations = LinkedListAllocationCount();
+
+        other = BenchmarkScatteredList(words, count);
+        LinkedListResetAllocationCount();
+        start = BenchmarkNow();
+        other = RemoveAndRecreate(other);
+        elapsed = BenchmarkNow() - start;
+        recreateTime = (elapsed < recreateTime) ? elapsed : recreateTime;
+        recreateAllocations = LinkedListAllocationCount();
+
+        if (!SameOrder(list, other)) {
+            printf("The two ways left different orders\n");
+            return 1;
+        }
+        BenchmarkFreeList(other);
+        BenchmarkFreeList(list);
+    }
+    printf("NULLs to the front, 50%% NULL:\n");
+    printf("  %-22s %8.1f ms %10u allocations\n", "LinkedListPartitionNull", partitionTime * 1e3,
+            partitionAllocations);
+    printf("  %-22s %8.1f ms %10u allocations\n", "remove + re-malloc", recreateTime * 1e3,
+            recreateAllocations);
+
+    free(words);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * Moves the NULLs to the front the way a list without relinking would: removes every NULL item
+ * and creates a new one for it at the front. Returns the new head.
+ */
+static ListItem *RemoveAndRecreate(ListItem *list)
+{
+    ListItem *item = list, *next, *nullHead = NULL, *nullTail = NULL;
+    while (item != NULL) {
+        next = item->nextItem;
+        if (item->data == NULL) {
+            if (item == list) {
+                list = next;
+            }
+            LinkedListRemove(item);
+            nullTail = (nullTail == NULL) ? LinkedListNew(NULL) : LinkedListCreateAfter(nullTail,
+                    NULL);
+            nullHead = (nullHead == NULL) ? nullTail : nullHead;
+        }
+        item = next;
+    }
+    if (nullTail == NULL) {
+        return list;
+    }
+    if (list != NULL) {
+        LinkedListConcatenate(nullTail, list);
+    }
+    return nullHead;
+}
+
+/*
+ * Returns TRUE if two lists, given by their heads, hold the same data in the same order.
+ */
+static int SameOrder(ListItem *first, ListItem *second)
+{
+    while (first != NULL && second != NULL) {
+        if (first->data != second->data) {
+            return FALSE;
+        }
+        first = first->nextItem;
+        second = second->nextItem;
+    }
+    return (first == NULL && second == NULL);
+}
@@ -0,0 +1,159 @@
+/*
+ * File:   PipelineBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times ListPipelineIngest() at several batch sizes against ListTokenize() followed by
+ * ListMultisetFromList() on case-folded English-like text, building both the list and the counts,
+ * and then only counting. Every run must find the same words and counts as the serial one. The
+ * pipeline needs a second core to overlap its threads, so the speedup depends on the machine.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/PipelineBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTokenizer.c ListMultiset.c WordCount.c
+ *         ListPipeline.c ListTiming.c -pthread -o pipeline
+ *     ./pipeline [text size in MiB, default 6]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListTokenizer.h"
+#include "ListMultiset.h"
+#include "ListPipeline.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define REPEATS 5
+#define BATCH_SIZES 5
+
+// **** Declare any data types here ****
+typedef struct {
+    int words; //list size, or 0 if no list was built
+    int distinct;
+    int total;
+} IngestResult;
+
+// **** Define any module-level, global, or external variables here ****
+static const int batches[BATCH_SIZES] = {1, 16, 64, 256, 1024};
+
+// **** Declare any function prototypes here ****
+static int AddWord(char *word, void *context);
+static double Run(int batch, int buildList, const char *text, char *buffer, unsigned long length,
+        IngestResult *result);
+static int Check(const char *name, const IngestResult *result, const IngestResult *expected);
+
+int main(int argc, char **argv)
+{
+    unsigned long length = ((argc > 1) ? strtoul(argv[1], NULL, 10) : 6) * 1024 * 1024;
+    char *text = malloc(length + 1), *buffer = malloc(length + 1);
+    IngestResult serial, serialCount, result;
+    char name[48];
+    double seconds;
+    int i;
+
+    if (text == NULL || buffer == NULL || length == 0 || BenchmarkText(text, length) != SUCCESS) {
+        printf("Couldn't set up %lu bytes of text\n", length);
+        return 1;
+    }
+
+    //batch 0 stands for the serial path
+    seconds = Run(0, TRUE, text, buffer, length, &serial);
+    printf("%lu MiB of text, %d words, %d distinct, case folded, best of %d, ms\n", length >> 20,
+            serial.words, serial.distinct, REPEATS);
+    printf("list and counts:\n");
+    printf("  %-40s %8.1f\n", "ListTokenize() + ListMultisetFromList()", seconds * 1e3);
+    for (i = 0; i < BATCH_SIZES; i++) {
+        seconds = Run(batches[i], TRUE, text, buffer, length, &result);
+        snprintf(name, sizeof (name), "ListPipelineIngest(), batch %d", batches[i]);
+        printf("  %-40s %8.1f\n", name, seconds * 1e3);
+        if (Check(name, &result, &serial) != SUCCESS) {
+            return 1;
+        }
+    }
+
+    printf("counts only:\n");
+    seconds = Run(0, FALSE, text, buffer, length, &serialCount);
+    printf("  %-40s %8.1f\n", "ListTokenizeEach() + ListMultisetAdd()", seconds * 1e3);
+    seconds = Run(LIST_PIPELINE_BATCH, FALSE, text, buffer, length, &result);
+    snprintf(name, sizeof (name), "ListPipelineIngest(), batch %d", LIST_PIPELINE_BATCH);
+    printf("  %-40s %8.1f\n", name, seconds * 1e3);
+    serial.words = 0;
+    if (Check("ListTokenizeEach()", &serialCount, &serial) != SUCCESS
+            || Check(name, &result, &serial) != SUCCESS) {
+        return 1;
+    }
+
+    free(buffer);
+    free(text);
+    return 0;
+}
+
+/*
+ * ListWordCallback that adds the word to the multiset in context.
+ */
+static int AddWord(char *word, void *context)
+{
+    return ListMultisetAdd(context, word, 1);
+}
+
+/*
+ * Ingests a fresh copy of text REPEATS times, serially if batch is 0 and through the pipeline
+ * otherwise, building the list or only counting, and returns the best time. What the last run
+ * found is stored in result.
+ */
+static double Run(int batch, int buildList, const char *text, char *buffer, unsigned long length,
+        IngestResult *result)
+{
+    double best = 1e9, start, elapsed;
+    ListMultiset counts;
+    ListItem *tail;
+    int repeat;
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        memcpy(buffer, text, length + 1);
+        ListMultisetInit(&counts);
+        tail = NULL;
+        start = BenchmarkNow();
+        if (batch > 0) {
+            ListPipelineIngest(buffer, length, LIST_TOKENIZE_FOLD_CASE, batch,
+                    buildList ? &tail : NULL, &counts);
+        } else if (buildList) {
+            ListTokenize(buffer, length, LIST_TOKENIZE_FOLD_CASE, &tail);
+            ListMultisetFromList(&counts, tail);
+        } else {
+            ListTokenizeEach(buffer, length, LIST_TOKENIZE_FOLD_CASE, AddWord, &counts);
+        }
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+        result->words = (tail != NULL) ? LinkedListSize(tail) : 0;
+        result->distinct = counts.distinct;
+        result->total = counts.total;
+        BenchmarkFreeList(tail);
+        ListMultisetFree(&counts);
+    }
+    return best;
+}
+
+/*
+ * Prints what differs between result and expected, and returns SUCCESS if nothing does.
+ */
+static int Check(const char *name, const IngestResult *result, const IngestResult *expected)
+{
+    if (result->words != expected->words || result->distinct != expected->distinct
+            || result->total != expected->total) {
+        printf("%s found %d words, %d distinct, %d counted instead of %d, %d, %d\n", name,
+                result->words, result->distinct, result->total, expected->words,
+                expected->distinct, expected->total);
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
@@ -0,0 +1,122 @@
+/*
+ * File:   ShardedBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times ShardedWordCount() with 1, 2, 4, 8 and 16 shards on a list of Zipf-distributed
+ * words. On a list small enough for it, UnsortedWordCount() is timed too; otherwise 1 shard is the
+ * reference. Every shard count must give the reference's output. The shards only run in parallel
+ * with more than one core, so how the times scale depends on the machine.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/ShardedBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c WordCount.c ListTiming.c -pthread -o sharded
+ *     ./sharded [list size], by default 20000 and then 1000000
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "WordCount.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 20000
+#define REPEATS 3
+
+// UnsortedWordCount() is quadratic, so it is only timed on lists up to this size
+#define UNSORTED_MAX_ITEMS 50000
+
+// **** Declare any function prototypes here ****
+static int Run(int count);
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) {
+        return Run(atoi(argv[1]));
+    }
+    if (Run(20000) != 0) {
+        return 1;
+    }
+    return Run(1000000);
+}
+
+/*
+ * Counts a list of count Zipf words every way and prints the best times. Returns 0, or 1 if an
+ * output differs from the reference or something couldn't be set up.
+ */
+static int Run(int count)
+{
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 10);
+    double *zipf = BenchmarkZipfTable(VOCABULARY_SIZE);
+    char **words = malloc(count * sizeof (char *));
+    int *reference = malloc(count * sizeof (int));
+    int *wordCount = malloc(count * sizeof (int));
+    double best, start, elapsed;
+    int shards, repeat, i;
+    ListItem *list;
+
+    if (vocabulary == NULL || zipf == NULL || words == NULL || reference == NULL
+            || wordCount == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        words[i] = vocabulary[BenchmarkZipf(zipf, VOCABULARY_SIZE)];
+    }
+    list = BenchmarkScatteredList(words, count);
+    if (list == NULL) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+
+    printf("%d Zipf words from a %d word vocabulary, best of %d, ms\n", count, VOCABULARY_SIZE,
+            REPEATS);
+    if (count <= UNSORTED_MAX_ITEMS) {
+        best = 1e9;
+        for (repeat = 0; repeat < REPEATS; repeat++) {
+            start = BenchmarkNow();
+            UnsortedWordCount(list, reference);
+            elapsed = BenchmarkNow() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        printf("  %-28s %10.1f\n", "UnsortedWordCount()", best * 1e3);
+    }
+    for (shards = 1; shards <= WORD_COUNT_MAX_SHARDS; shards *= 2) {
+        best = 1e9;
+        for (repeat = 0; repeat < REPEATS; repeat++) {
+            start = BenchmarkNow();
+            if (ShardedWordCount(list, wordCount, shards) != SUCCESS) {
+                printf("ShardedWordCount() failed with %d shards\n", shards);
+                return 1;
+            }
+            elapsed = BenchmarkNow() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+        printf("  ShardedWordCount(), %2d shard%s %10.1f\n", shards, (shards > 1) ? "s" : " ",
+                best * 1e3);
+        if (count > UNSORTED_MAX_ITEMS && shards == 1) {
+            memcpy(reference, wordCount, count * sizeof (int));
+        } else if (memcmp(reference, wordCount, count * sizeof (int)) != 0) {
+            printf("%d shards gave a different output\n", shards);
+            return 1;
+        }
+    }
+
+    BenchmarkFreeList(list);
+    free(wordCount);
+    free(reference);
+    free(words);
+    free(zipf);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * File:   SnapshotBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: compares two ways of getting a large word list at startup. One reads a text file and
+ * rebuilds the list with ListTokenize(). The other opens a snapshot with ListSnapshotOpen() and
+ * walks it once, reading every word. Both must see the same words. The files are made in the
+ * current directory, snapshot_words.txt and snapshot_words.lls, and removed afterwards. They are
+ * in the page cache by the time they are timed, so this measures the work done at startup, not
+ * the disk.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/SnapshotBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTokenizer.c ListSnapshot.c ListTiming.c
+ *         -pthread -o snapshot
+ *     ./snapshot [text size in MiB, default 12]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListTokenizer.h"
+#include "ListSnapshot.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define TEXT_PATH "snapshot_words.txt"
+#define SNAPSHOT_PATH "snapshot_words.lls"
+#define REPEATS 5
+
+// **** Declare any function prototypes here ****
+static ListItem *Rebuild(char **buffer);
+static unsigned long ListLetters(ListItem *list);
+static unsigned long SnapshotLetters(const ListSnapshot *snapshot);
+
+int main(int argc, char **argv)
+{
+    unsigned long length = ((argc > 1) ? strtoul(argv[1], NULL, 10) : 12) * 1024 * 1024;
+    unsigned long listLetters = 0, snapshotLetters = 0;
+    double rebuild = 1e9, write = 1e9, load = 1e9, start, elapsed;
+    char *text = malloc(length + 1), *buffer;
+    int listSize = 0, snapshotSize = 0, repeat;
+    ListSnapshot snapshot;
+    ListItem *list;
+    FILE *file;
+
+    if (text == NULL || length == 0 || BenchmarkText(text, length) != SUCCESS) {
+        printf("Couldn't set up %lu bytes of text\n", length);
+        return 1;
+    }
+    file = fopen(TEXT_PATH, "wb");
+    if (file == NULL || fwrite(text, 1, length, file) != length || fclose(file) != 0) {
+        printf("Couldn't write %s\n", TEXT_PATH);
+        return 1;
+    }
+    free(text);
+
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        start = BenchmarkNow();
+        list = Rebuild(&buffer);
+        elapsed = BenchmarkNow() - start;
+        rebuild = (elapsed < rebuild) ? elapsed : rebuild;
+        if (list == NULL) {
+            printf("Couldn't rebuild the list from %s\n", TEXT_PATH);
+            return 1;
+        }
+        listSize = LinkedListSize(list);
+        listLetters = ListLetters(list);
+
+        start = BenchmarkNow();
+        if (ListSnapshotWrite(list, SNAPSHOT_PATH) != SUCCESS) {
+            printf("Couldn't write %s\n", SNAPSHOT_PATH);
+            return 1;
+        }
+        elapsed = BenchmarkNow() - start;
+        write = (elapsed < write) ? elapsed : write;
+        BenchmarkFreeList(list);
+        free(buffer);
+
+        start = BenchmarkNow();
+        if (ListSnapshotOpen(&snapshot, SNAPSHOT_PATH) != SUCCESS) {
+            printf("Couldn't open %s\n", SNAPSHOT_PATH);
+            return 1;
+        }
+        snapshotLetters = SnapshotLetters(&snapshot);
+        elapsed = BenchmarkNow() - start;
+        load = (elapsed < load) ? elapsed : load;
+        snapshotSize = ListSnapshotSize(&snapshot);
+        ListSnapshotClose(&snapshot);
+    }
+
+    printf("%lu MiB of text, %d words, best of %d, ms\n", length >> 20, listSize, REPEATS);
+    printf("  %-40s %10.2f\n", "read text + ListTokenize()", rebuild * 1e3);
+    printf("  %-40s %10.2f\n", "ListSnapshotWrite(), ahead of time", write * 1e3);
+    printf("  %-40s %10.2f\n", "ListSnapshotOpen() + one full walk", load * 1e3);
+    remove(SNAPSHOT_PATH);
+    remove(TEXT_PATH);
+    if (listSize != snapshotSize || listLetters != snapshotLetters) {
+        printf("The snapshot has %d words and %lu letters instead of %d and %lu\n", snapshotSize,
+                snapshotLetters, listSize, listLetters);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Reads TEXT_PATH into a malloc()ed buffer, which the words point into, and tokenizes it. Returns
+ * the head of the list, or NULL if anything fails.
+ */
+static ListItem *Rebuild(char **buffer)
+{
+    FILE *file = fopen(TEXT_PATH, "rb");
+    ListItem *tail = NULL;
+    long length;
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    *buffer = malloc(length + 1);
+    if (*buffer == NULL || fread(*buffer, 1, length, file) != (unsigned long) length) {
+        fclose(file);
+        free(*buffer);
+        return NULL;
+    }
+    fclose(file);
+    (*buffer)[length] = '\0';
+    if (ListTokenize(*buffer, length, 0, &tail) != SUCCESS || tail == NULL) {
+        free(*buffer);
+        return NULL;
+    }
+    return LinkedListGetFirst(tail);
+}
+
+/*
+ * Adds up the lengths of the words in a list, given by its head.
+ */
+static unsigned long ListLetters(ListItem *list)
+{
+    unsigned long letters = 0;
+    for (; list != NULL; list = list->nextItem) {
+        letters += (list->data != NULL) ? strlen(list->data) : 0;
+    }
+    return letters;
+}
+
+/*
+ * Adds up the lengths of the words in a snapshot, walking it once in list order.
+ */
+static unsigned long SnapshotLetters(const ListSnapshot *snapshot)
+{
+    unsigned long letters = 0;
+    const char *data;
+    int index;
+    for (index = ListSnapshotFirst(snapshot); index >= 0;
+            index = ListSnapshotNext(snapshot, index)) {
+        data = ListSnapshotData(snapshot, index);
+        letters += (data != NULL) ? strlen(data) : 0;
+    }
+    return letters;
+}
@@ -0,0 +1,125 @@
+/*
+ * File:   SortAndCountBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: times LinkedListSortAndCount() against the three-step LinkedListSortNatural(),
+ * LinkedListSize() and SortedWordCount() pipeline it replaces, on a list whose items are scattered
+ * across the heap, with the words already in order and shuffled. Both must give the same counts.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/SortAndCountBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c WordCount.c ListTiming.c -pthread
+ *         -o sortandcount
+ *     ./sortandcount [list size, default 1000000]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "WordCount.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define VOCABULARY_SIZE 50000
+#define REPEATS 5
+
+// **** Declare any function prototypes here ****
+static int CompareWords(const void *first, const void *second);
+static void Compare(const char *name, char **words, int count, int *separate, int *fused);
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000, i;
+    char **vocabulary = BenchmarkVocabulary(VOCABULARY_SIZE, 3, 12);
+    char **words = malloc(count * sizeof (char *));
+    int *separate = malloc(count * sizeof (int));
+    int *fused = malloc(count * sizeof (int));
+
+    if (vocabulary == NULL || words == NULL || separate == NULL || fused == NULL || count < 1) {
+        printf("Couldn't set up a %d item list\n", count);
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        words[i] = vocabulary[BenchmarkRandom() % VOCABULARY_SIZE];
+    }
+
+    printf("%d items from a %d word vocabulary, best of %d, ms\n", count, VOCABULARY_SIZE,
+            REPEATS);
+    printf("%-10s %12s %12s %12s\n", "", "sort alone", "three-step", "fused");
+    Compare("shuffled", words, count, separate, fused);
+    qsort(words, count, sizeof (char *), CompareWords);
+    Compare("in order", words, count, separate, fused);
+
+    free(fused);
+    free(separate);
+    free(words);
+    BenchmarkFreeWords(vocabulary, VOCABULARY_SIZE);
+    return 0;
+}
+
+/*
+ * qsort() comparison in LinkedListSort() order.
+ */
+static int CompareWords(const void *first, const void *second)
+{
+    return LinkedListCompare(*(char * const *) first, *(char * const *) second);
+}
+
+/*
+ * Times sorting a scattered list of words alone, then sorting and counting it in three steps and
+ * fused, each on a fresh list, and prints the best times.
+ */
+static void Compare(const char *name, char **words, int count, int *separate, int *fused)
+{
+    double sortAlone = 1e9, threeStep = 1e9, fusedTime = 1e9, start, elapsed;
+    WordCountCursor cursor;
+    ListItem *list;
+    int repeat, i;
+
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        list = BenchmarkScatteredList(words, count);
+        start = BenchmarkNow();
+        LinkedListSortNatural(list);
+        elapsed = BenchmarkNow() - start;
+        sortAlone = (elapsed < sortAlone) ? elapsed : sortAlone;
+        BenchmarkFreeList(list);
+
+        list = BenchmarkScatteredList(words, count);
+        start = BenchmarkNow();
+        LinkedListSortNatural(list);
+        list = LinkedListGetFirst(list);
+        if (LinkedListSize(list) == count) {
+            SortedWordCount(list, separate);
+        }
+        elapsed = BenchmarkNow() - start;
+        threeStep = (elapsed < threeStep) ? elapsed : threeStep;
+        BenchmarkFreeList(list);
+
+        list = BenchmarkScatteredList(words, count);
+        cursor.wordCount = fused;
+        cursor.i = 0;
+        start = BenchmarkNow();
+        LinkedListSortAndCount(list, ExpandWordRun, &cursor, &list);
+        elapsed = BenchmarkNow() - start;
+        fusedTime = (elapsed < fusedTime) ? elapsed : fusedTime;
+        BenchmarkFreeList(list);
+
+        for (i = 0; i < count; i++) {
+            if (separate[i] != fused[i]) {
+                printf("The counts differ at item %d\n", i);
+                exit(1);
+            }
+        }
+    }
+    printf("%-10s %12.1f %12.1f %12.1f\n", name, sortAlone * 1e3, threeStep * 1e3,
+            fusedTime * 1e3);
+}
@@ -0,0 +1,194 @@
+/*
+ * File:   TokenizerBenchmark.c
+ * Author: Dylan Yong
+ *
+ * Created on October 19, 2026
+ */
+
+/*
+ * Host-only: measures ListTokenize() and ListTokenizeEach() throughput in GB/s against a scalar
+ * isalpha()/tolower() loop with the same in-place contract, both building a list and only handing
+ * out the words, and checks that they find the same number of words.
+ *     gcc -O2 -I. -Ibenchmarks -I<xc.h dir> benchmarks/TokenizerBenchmark.c
+ *         benchmarks/BenchmarkSupport.c LinkedList.c ListTokenizer.c ListTiming.c -pthread
+ *         -o tokenizer
+ *     ./tokenizer [text size in MiB, default 64]
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "ListTokenizer.h"
+#include "BenchmarkSupport.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define REPEATS 3
+
+// **** Declare any data types here ****
+typedef enum {
+    SCALAR,
+    SCALAR_FOLD,
+    TOKENIZER,
+    TOKENIZER_FOLD,
+    MODES
+} TokenizeMode;
+
+// **** Define any module-level, global, or external variables here ****
+static const char *modeNames[MODES] = {
+    "isalpha loop",
+    "isalpha + tolower",
+    "ListTokenize",
+    "ListTokenize + fold"
+};
+
+// **** Declare any function prototypes here ****
+static int ScalarTokenize(char *buffer, unsigned long length, int fold, ListWordCallback callback,
+        void *context);
+static int AppendWord(char *word, void *context);
+static int CountWord(char *word, void *context);
+static double Run(TokenizeMode mode, int buildList, const char *text, char *buffer,
+        unsigned long length, unsigned long *words);
+
+int main(int argc, char **argv)
+{
+    unsigned long length = ((argc > 1) ? strtoul(argv[1], NULL, 10) : 64) * 1024 * 1024;
+    char *text = malloc(length + 1), *buffer = malloc(length + 1);
+    unsigned long words[MODES][2];
+    TokenizeMode mode;
+    int buildList;
+
+    if (text == NULL || buffer == NULL || length == 0 || BenchmarkText(text, length) != SUCCESS) {
+        printf("Couldn't set up %lu bytes of text\n", length);
+        return 1;
+    }
+
+    printf("%lu MiB of text, best of %d, GB/s\n", length >> 20, REPEATS);
+    printf("%-20s %14s %16s\n", "", "list building", "tokenizing only");
+    for (mode = SCALAR; mode < MODES; mode++) {
+        double seconds[2];
+        for (buildList = 0; buildList < 2; buildList++) {
+            seconds[buildList] = Run(mode, buildList, text, buffer, length,
+                    &words[mode][buildList]);
+        }
+        printf("%-20s %14.2f %16.2f\n", modeNames[mode], length / seconds[1] / 1e9,
+                length / seconds[0] / 1e9);
+    }
+    for (mode = SCALAR; mode < MODES; mode++) {
+        for (buildList = 0; buildList < 2; buildList++) {
+            if (words[mode][buildList] != words[SCALAR][0]) {
+                printf("%s found %lu words instead of %lu\n", modeNames[mode],
+                        words[mode][buildList], words[SCALAR][0]);
+                return 1;
+            }
+        }
+    }
+    printf("%lu words each\n", words[SCALAR][0]);
+
+    free(buffer);
+    free(text);
+    return 0;
+}
+
+/*
+ * The scalar reference: classifies one byte at a time with isalpha() and folds with tolower(),
+ * NUL-terminating words in place just like ListTokenizeEach().
+ */
+static int ScalarTokenize(char *buffer, unsigned long length, int fold, ListWordCallback callback,
+        void *context)
+{
+    char *word = NULL;
+    unsigned long i;
+    for (i = 0; i < length; i++) {
+        unsigned char c = buffer[i];
+        if (isalpha(c)) {
+            if (fold) {
+                buffer[i] = tolower(c);
+            }
+            if (word == NULL) {
+                word = buffer + i;
+            }
+        } else if (word != NULL) {
+            buffer[i] = '\0';
+            if (callback(word, context) != SUCCESS) {
+                return STANDARD_ERROR;
+            }
+            word = NULL;
+        }
+    }
+    if (word != NULL) {
+        buffer[length] = '\0';
+        return callback(word, context);
+    }
+    return SUCCESS;
+}
+
+/*
+ * ListWordCallback that appends the word to the list whose tail is in context.
+ */
+static int AppendWord(char *word, void *context)
+{
+    ListItem **tail = context;
+    ListItem *item = LinkedListCreateAfter(*tail, word);
+    if (item == NULL) {
+        return STANDARD_ERROR;
+    }
+    *tail = item;
+    return SUCCESS;
+}
+
+/*
+ * ListWordCallback that only counts the words.
+ */
+static int CountWord(char *word, void *context)
+{
+    (void) word;
+    (*(unsigned long *) context)++;
+    return SUCCESS;
+}
+
+/*
+ * Tokenizes a fresh copy of text REPEATS times in the given mode, building a list or just counting
+ * the words, and returns the best time. The number of words found is stored in words.
+ */
+static double Run(TokenizeMode mode, int buildList, const char *text, char *buffer,
+        unsigned long length, unsigned long *words)
+{
+    int fold = (mode == SCALAR_FOLD || mode == TOKENIZER_FOLD);
+    int options = fold ? LIST_TOKENIZE_FOLD_CASE : 0;
+    double best = 1e9, start, elapsed;
+    ListItem *tail;
+    int repeat;
+    for (repeat = 0; repeat < REPEATS; repeat++) {
+        memcpy(buffer, text, length + 1);
+        tail = NULL;
+        *words = 0;
+        start = BenchmarkNow();
+        if (mode == SCALAR || mode == SCALAR_FOLD) {
+            if (buildList) {
+                ScalarTokenize(buffer, length, fold, AppendWord, &tail);
+            } else {
+                ScalarTokenize(buffer, length, fold, CountWord, words);
+            }
+        } else if (buildList) {
+            ListTokenize(buffer, length, options, &tail);
+        } else {
+            ListTokenizeEach(buffer, length, options, CountWord, words);
+        }
+        elapsed = BenchmarkNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+        if (buildList) {
+            *words = (tail != NULL) ? LinkedListSize(tail) : 0;
+            BenchmarkFreeList(tail);
+        }
+    }
+    return best;
+}
@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=BOARD.c LinkedListTest.c LinkedList.c
+SOURCEFILES_QUOTED_IF_SPACED=BOARD.c LinkedListTest.c LinkedList.c ListSnapshot.c ListTiming.c ListArena.c ListTokenizer.c ListMultiset.c ListPipeline.c ListArray.c WordCount.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/BOARD.o ${OBJECTDIR}/LinkedListTest.o ${OBJECTDIR}/LinkedList.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/BOARD.o.d ${OBJECTDIR}/LinkedListTest.o.d ${OBJECTDIR}/LinkedList.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/BOARD.o ${OBJECTDIR}/LinkedListTest.o ${OBJECTDIR}/LinkedList.o ${OBJECTDIR}/ListSnapshot.o ${OBJECTDIR}/ListTiming.o ${OBJECTDIR}/ListArena.o ${OBJECTDIR}/ListTokenizer.o ${OBJECTDIR}/ListMultiset.o ${OBJECTDIR}/ListPipeline.o ${OBJECTDIR}/ListArray.o ${OBJECTDIR}/WordCount.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/BOARD.o.d ${OBJECTDIR}/LinkedListTest.o.d ${OBJECTDIR}/LinkedList.o.d ${OBJECTDIR}/ListSnapshot.o.d ${OBJECTDIR}/ListTiming.o.d ${OBJECTDIR}/ListArena.o.d ${OBJECTDIR}/ListTokenizer.o.d ${OBJECTDIR}/ListMultiset.o.d ${OBJECTDIR}/ListPipeline.o.d ${OBJECTDIR}/ListArray.o.d ${OBJECTDIR}/WordCount.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/BOARD.o ${OBJECTDIR}/LinkedListTest.o ${OBJECTDIR}/LinkedList.o
+OBJECTFILES=${OBJECTDIR}/BOARD.o ${OBJECTDIR}/LinkedListTest.o ${OBJECTDIR}/LinkedList.o ${OBJECTDIR}/ListSnapshot.o ${OBJECTDIR}/ListTiming.o ${OBJECTDIR}/ListArena.o ${OBJECTDIR}/ListTokenizer.o ${OBJECTDIR}/ListMultiset.o ${OBJECTDIR}/ListPipeline.o ${OBJECTDIR}/ListArray.o ${OBJECTDIR}/WordCount.o
 
 # Source Files
-SOURCEFILES=BOARD.c LinkedListTest.c LinkedList.c
+SOURCEFILES=BOARD.c LinkedListTest.c LinkedList.c ListSnapshot.c ListTiming.c ListArena.c ListTokenizer.c ListMultiset.c ListPipeline.c ListArray.c WordCount.c
 
 
 CFLAGS=
@@ -124,6 +124,54 @@ ${OBJECTDIR}/LinkedList.o: LinkedList.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/LinkedList.o 
 	@${FIXDEPS} "${OBJECTDIR}/LinkedList.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/LinkedList.o.d" -o ${OBJECTDIR}/LinkedList.o LinkedList.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/ListSnapshot.o: ListSnapshot.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListSnapshot.o.d 
+	@${RM} ${OBJECTDIR}/ListSnapshot.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListSnapshot.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListSnapshot.o.d" -o ${OBJECTDIR}/ListSnapshot.o ListSnapshot.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListTiming.o: ListTiming.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListTiming.o.d 
+	@${RM} ${OBJECTDIR}/ListTiming.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListTiming.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListTiming.o.d" -o ${OBJECTDIR}/ListTiming.o ListTiming.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListArena.o: ListArena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListArena.o.d 
+	@${RM} ${OBJECTDIR}/ListArena.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListArena.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListArena.o.d" -o ${OBJECTDIR}/ListArena.o ListArena.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListTokenizer.o: ListTokenizer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListTokenizer.o.d 
+	@${RM} ${OBJECTDIR}/ListTokenizer.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListTokenizer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListTokenizer.o.d" -o ${OBJECTDIR}/ListTokenizer.o ListTokenizer.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListMultiset.o: ListMultiset.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListMultiset.o.d 
+	@${RM} ${OBJECTDIR}/ListMultiset.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListMultiset.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListMultiset.o.d" -o ${OBJECTDIR}/ListMultiset.o ListMultiset.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListPipeline.o: ListPipeline.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListPipeline.o.d 
+	@${RM} ${OBJECTDIR}/ListPipeline.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListPipeline.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListPipeline.o.d" -o ${OBJECTDIR}/ListPipeline.o ListPipeline.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListArray.o: ListArray.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListArray.o.d 
+	@${RM} ${OBJECTDIR}/ListArray.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListArray.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListArray.o.d" -o ${OBJECTDIR}/ListArray.o ListArray.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/WordCount.o: WordCount.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/WordCount.o.d 
+	@${RM} ${OBJECTDIR}/WordCount.o 
+	@${FIXDEPS} "${OBJECTDIR}/WordCount.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DSimulator=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/WordCount.o.d" -o ${OBJECTDIR}/WordCount.o WordCount.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
 else
 ${OBJECTDIR}/BOARD.o: BOARD.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
@@ -143,6 +191,54 @@ ${OBJECTDIR}/LinkedList.o: LinkedList.c  nbproject/Makefile-${CND_CONF}.mk
 	@${RM} ${OBJECTDIR}/LinkedList.o 
 	@${FIXDEPS} "${OBJECTDIR}/LinkedList.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/LinkedList.o.d" -o ${OBJECTDIR}/LinkedList.o LinkedList.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/ListSnapshot.o: ListSnapshot.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListSnapshot.o.d 
+	@${RM} ${OBJECTDIR}/ListSnapshot.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListSnapshot.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListSnapshot.o.d" -o ${OBJECTDIR}/ListSnapshot.o ListSnapshot.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListTiming.o: ListTiming.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListTiming.o.d 
+	@${RM} ${OBJECTDIR}/ListTiming.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListTiming.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListTiming.o.d" -o ${OBJECTDIR}/ListTiming.o ListTiming.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListArena.o: ListArena.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListArena.o.d 
+	@${RM} ${OBJECTDIR}/ListArena.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListArena.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListArena.o.d" -o ${OBJECTDIR}/ListArena.o ListArena.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListTokenizer.o: ListTokenizer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListTokenizer.o.d 
+	@${RM} ${OBJECTDIR}/ListTokenizer.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListTokenizer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListTokenizer.o.d" -o ${OBJECTDIR}/ListTokenizer.o ListTokenizer.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListMultiset.o: ListMultiset.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListMultiset.o.d 
+	@${RM} ${OBJECTDIR}/ListMultiset.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListMultiset.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListMultiset.o.d" -o ${OBJECTDIR}/ListMultiset.o ListMultiset.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListPipeline.o: ListPipeline.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListPipeline.o.d 
+	@${RM} ${OBJECTDIR}/ListPipeline.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListPipeline.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListPipeline.o.d" -o ${OBJECTDIR}/ListPipeline.o ListPipeline.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/ListArray.o: ListArray.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/ListArray.o.d 
+	@${RM} ${OBJECTDIR}/ListArray.o 
+	@${FIXDEPS} "${OBJECTDIR}/ListArray.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/ListArray.o.d" -o ${OBJECTDIR}/ListArray.o ListArray.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/WordCount.o: WordCount.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/WordCount.o.d 
+	@${RM} ${OBJECTDIR}/WordCount.o 
+	@${FIXDEPS} "${OBJECTDIR}/WordCount.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -Wall -MMD -MF "${OBJECTDIR}/WordCount.o.d" -o ${OBJECTDIR}/WordCount.o WordCount.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -15,25 +15,41 @@
 
 // User libraries
 #include "LinkedList.h"
+#include "ListTiming.h"
+#include "WordCount.h"
 
 // **** Set any macros or preprocessor directives here ****
 
 // **** Declare any data types here ****
 
 // **** Define any module-level, global, or external variables here ****
-static char *dog = "dog";
-static char *pig1 = "pig";
-static char *pig2 = "pig";
-static char *cow = "cow";
-static char *cat = "cat";
-static char *turtle = "turtle";
-static char *bird = "bird";
-static char *crab = "crab";
+//arrays rather than pointers so their addresses are constants the word list below can use, and so
+//pig1 and pig2 are guaranteed to be different strings with the same contents
+static char dog[] = "dog";
+static char pig1[] = "pig";
+static char pig2[] = "pig";
+static char cow[] = "cow";
+static char cat[] = "cat";
+static char turtle[] = "turtle";
+static char bird[] = "bird";
+static char crab[] = "crab";
+
+//the unsorted word list, fully linked at compile time so it costs nothing at startup
+static const ListItem unsortedWords[] = {
+    LINKEDLIST_CONSTANT_HEAD(unsortedWords, crab),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 1, turtle),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 2, cat),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 3, pig2),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 4, bird),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 5, cow),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 6, dog),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 7, NULL),
+    LINKEDLIST_CONSTANT_ITEM(unsortedWords, 8, cow),
+    LINKEDLIST_CONSTANT_TAIL(unsortedWords, 9, pig1),
+};
 
 // **** Declare any function prototypes here ****
 int InitializeUnsortedWordList(ListItem **unsortedWordList);
-int UnsortedWordCount(ListItem *list, int *wordCount);
-int SortedWordCount(ListItem *list, int *wordCount);
 
 int main()
 {
@@ -58,6 +74,7 @@ int main()
     // Get the word counts for every string in the list
     int g = LinkedListSize(unsortedWordList);
     int wordCount[g];
+    int i;
 
     // Print the word count results
     unsortedWordList = LinkedListGetFirst(unsortedWordList);
@@ -70,29 +87,69 @@ int main()
     } else {
         printf("ERROR\n");
     }
+
+    // The same counts from the sharded counter, which should match exactly
+    int shardedWordCount[g];
+    if (ShardedWordCount(unsortedWordList, shardedWordCount, 4)) {
+        printf("[");
+        for (i = 0; i < g; i++) {
+            printf(i < g - 1 ? "%d, " : "%d]\n", shardedWordCount[i]);
+        }
+    } else {
+        printf("ERROR\n");
+    }
     printf("\n");
 
     /******************************** Your custom code goes below here ********************************/
     //printf("Welcome to CMPE13 Lab5 Blank. Please remove before starting.\r\n");
     ListItem *sortedWordList = NULL;
     ListItem *tempItem;
-    LinkedListSort(unsortedWordList);
-    sortedWordList = unsortedWordList;
-    LinkedListPrint(sortedWordList);
-    g = LinkedListSize(sortedWordList); //gets size of sorted word list
+    //sorting doesn't change the size, and the counts come out of the pass that finishes the sort
     int sortedWordCount[g];
+    WordCountCursor countCursor = {sortedWordCount, 0};
+    //sorting changes the list, so this is where the constant word list gets copied to the heap
+    if (!LinkedListCopyOnWrite(&unsortedWordList, unsortedWords,
+            LINKEDLIST_CONSTANT_SIZE(unsortedWords))) {
+        printf("ERROR: Failed to copy word list\n");
+        while (TRUE);
+    }
+    LinkedListSortAndCount(unsortedWordList, ExpandWordRun, &countCursor, &sortedWordList);
+    LinkedListPrint(sortedWordList);
 
-    SortedWordCount(sortedWordList, sortedWordCount); //sorted word count function
     //printWordCount
-    int i;
     printf("[");
     for (i = 0; i < (g - 1); i++) { //prints sorted word count
         printf("%d, ", sortedWordCount[i]);
     }
-    i++;
 
-    //Clear SortedWordList
     printf("%d]\n\n", sortedWordCount[i]);
+
+    //Distinct word runs
+    WordCountPair wordRuns[g];
+    int runCount;
+    if (SortedWordRuns(sortedWordList, wordRuns, g, &runCount) == SUCCESS) {
+        printf("Runs:");
+        for (i = 0; i < runCount; i++) {
+            printf(" %s=%d", wordRuns[i].word, wordRuns[i].count);
+        }
+        printf("\n\n");
+    } else {
+        printf("ERROR\n");
+    }
+
+    //Top 3 words
+    WordCountPair topWords[3];
+    int found;
+    if (TopKWordCount(sortedWordList, 3, topWords, &found)) {
+        printf("Top words:");
+        for (i = 0; i < found; i++) {
+            printf(" %s=%d", topWords[i].word, topWords[i].count);
+        }
+        printf("\n\n");
+    } else {
+        printf("ERROR\n");
+    }
+    //Clear SortedWordList
     sortedWordList = LinkedListGetFirst(sortedWordList);
     for (i = 0; i < g; i++) {
         tempItem = sortedWordList->nextItem;
@@ -103,15 +160,14 @@ int main()
     printf("Sorted Print status: %d\n", status); // if 0 then clear is complete
 
     //Clear UnsortedWordList
-    g = LinkedListSize(unsortedWordList);
-    unsortedWordList = LinkedListGetFirst(unsortedWordList);
-    for (i = 0; i < g; i++) {
-        tempItem = unsortedWordList->nextItem;
-        LinkedListRemove(unsortedWordList);
-        unsortedWordList = tempItem;
-    }
+    //it was sorted in place, so its items were already freed along with sortedWordList
+    unsortedWordList = NULL;
     status = LinkedListPrint(unsortedWordList);
     printf("Unsported Print status: %d\n", status); // if 0 then clear is complete
+
+#ifdef LINKEDLIST_TIMING
+    ListTimingPrint();
+#endif
     /******************************** Your custom code goes above here ********************************/
 
     // You can never return from main() in an embedded system (one that lacks an operating system).
@@ -119,210 +175,23 @@ int main()
     while (1);
 }
 
-/**
- * This functions takes in the head of an unsorted list of words, and an array to store the number
- * of occurrences of each word.  The first time a word appears, the number of occurrences of that
- * word should be stored in the corresponding position in the array.  For repeated words the
- * negative of the number of occurrences should be stored.  For example, a list of the following
- * words should return an array with the following values:
- *     {"hair", "comb", "brush", "brush"} -> {1, 1, 2, -2}
- *
- * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
- * as regular strings that can have multiple occurrences, including the empty string, as the
- * following output demonstrates.
- *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
- *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
- *
- * NOTE: This function assumes that wordCount is the same length as list.
- * @param list A pointer to the head of a doubly-linked list containing unsorted words.
- * @param wordCount An array of integers. The output of this function is stored here. It must be
- *                  at least as big as the linked list pointed to be `list` is.
- * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
- */
-int UnsortedWordCount(ListItem *list, int *wordCount)
-{
-    // Make sure the head of the list was given.
-    if (list->previousItem != NULL) {
-        return STANDARD_ERROR;
-    }
-
-    char *word1;
-    char *word2;
-    char *repCheck;
-    ListItem *item1 = list;
-    ListItem *item2;
-    int temp, firstOccurencePos;
-    int repetitionFlag = 0;
-    int i, j;
-
-    i = 0;
-    while (item1 != NULL) {
-        // Count first occurrence
-        j = 1;
-        // Ignore NULL words
-        word1 = item1->data;
-        if (word1 == NULL) {
-            wordCount[i++] = 0;
-            item1 = item1->nextItem;
-            continue;
-        }
-
-        // Check previous occurrences
-        temp = i;
-        item2 = item1->previousItem;
-        while (item2 != NULL) {
-            --temp;
-            repCheck = item2->data;
-            if (repCheck != NULL && strcmp(repCheck, word1) == 0) {
-                repetitionFlag = 1;
-                firstOccurencePos = temp;
-            }
-            item2 = item2->previousItem;
-        }
-
-        // Count new occurrences
-        if (repetitionFlag == 0) {
-            item2 = LinkedListGetFirst(list);
-            while (item2 != NULL) {
-                word2 = item2->data;
-                if (word2 != NULL && item1 != item2 && strcmp(word1, word2) == 0) {
-                    ++j;
-                }
-                item2 = item2->nextItem;
-            }
-            wordCount[i++] = j;
-        } else {
-            wordCount[i++] = -wordCount[firstOccurencePos];
-            repetitionFlag = 0;
-        }
-        item1 = item1->nextItem;
-    }
-    return SUCCESS;
-}
-
 /**
  * This function initializes a list of ListItems for use when testing the LinkedList implementation
- * and word count algorithms.
+ * and word count algorithms. The list is the constant unsortedWords, so nothing is allocated; it
+ * can be read directly but must go through LinkedListCopyOnWrite() before it is changed.
  *
  * Usage:
  * ListItem *newList;
  * InitializeUnsortedWordList(&newList);
  *
  * @param unsortedWordList[out] Where to store the pointer to the head of the list.
- * @return SUCCESS if it succeeds, STANDARD_ERROR if it fails to allocate necessary memory.
+ * @return SUCCESS if it succeeds, STANDARD_ERROR if unsortedWordList is NULL.
  */
 int InitializeUnsortedWordList(ListItem **unsortedWordList)
 {
-    ListItem *tmp = LinkedListNew(crab);
-    if (!tmp) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, pig1)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cow)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, NULL)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, dog)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cow)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, bird)) {
+    if (!unsortedWordList) {
         return STANDARD_ERROR;
     }
-    if (!LinkedListCreateAfter(tmp, pig2)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cat)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, turtle)) {
-        return STANDARD_ERROR;
-    }
-    *unsortedWordList = tmp;
+    *unsortedWordList = (ListItem *) unsortedWords;
     return SUCCESS;
 }
-
-/**
- * SortedWordCount() takes in the head of a sorted list of words arranged lexicographically, and an
- * array to store the number of occurrences of each word.  The first time a word appears, the number
- * of occurrences of that word should be stored in the corresponding position in the array.  For
- * duplicate words a negative value of the number of occurrences should be stored.  For example, a
- * list of the following words should return an array with the following values:
- *     {"brush", "brush", "comb", "hair"} -> {2, -2, 1, 1}
- *
- * NULL values are treated as non-strings, so they always count as 0. Every other string is treated
- * as regular strings that can have multiple occurrences, including the empty string, as the
- * following output demonstrates.
- *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
- *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
- *
- * NOTE: This function assumes that wordCount is the same length as list.
- * @param list A pointer to the head of a doubly-linked list containing sorted words.
- * @param wordCount An array of integers. The output of this function is stored here. It must be
- *                  at least as big as the linked list pointed to be `list` is.
- * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
- */
-int SortedWordCount(ListItem *list, int *wordCount)
-{
-    list = LinkedListGetFirst(list);
-    if (list == NULL) { //NULL check
-        return STANDARD_ERROR;
-    }
-    int i = 0;
-    int counter, fourC;
-    while (list->data == NULL) { //All NULLs are at beginning
-        list = list->nextItem; //so this loop just counts them
-        wordCount[i] = 0; //and moves on once they're gone
-        i++;
-    }
-    while (1) {
-        //sets counter to 1 by default
-        counter = 1;
-        //if there are multiples, enter this loop
-        while (list->data == list->nextItem->data) {
-            counter++;
-            list = list->nextItem;
-            if (list->nextItem == NULL) {
-                //counter++;
-                //counter--;
-                break;
-            }
-        }
-        //if there is only one then save and increment
-        if (counter == 1) {
-            wordCount[i] = 1;
-            i++;
-            //if there are multiples then save their amount as negative and increment
-        } else {
-            wordCount[i] = counter;
-            i++;
-            for (fourC = 0; (fourC < counter - 1); fourC++) {
-                counter = (-1) * counter;
-                wordCount[i] = counter;
-                i++;
-            }
-        }
-        //if the next ListItem isnt a null then increment
-        if (list->nextItem != NULL) {
-            list = list->nextItem;
-        }
-        //if its the last item and it doesn't match with previous items, then save and end
-        if (list->nextItem == NULL && list->previousItem->data != list->data) {
-            ++i;
-            wordCount[i] = 1;
-            break;
-            //if all previous ListItems are accounted for then end
-        } else if (list->nextItem == NULL) {
-            break;
-        }
-
-    }
-    return SUCCESS;
-}
-